@@ -62,11 +62,15 @@ void chi_diffusion::Solver::CFEM_Assemble_A_and_b(chi_mesh::Cell& cell,
   // Dirichlets are just collected
   std::vector<int>    dirichlet_count(num_nodes, 0);
   std::vector<double> dirichlet_value(num_nodes, 0.0);
-  for (int f=0; f<cell.faces.size(); f++)
+  const auto& mesh_view = grid->GetPackedView();
+  const uint64_t face_base = mesh_view.FaceIndex(cell.local_id, 0);
+  const int num_faces = mesh_view.NumCellFaces(cell.local_id);
+  for (int f=0; f<num_faces; f++)
   {
-    if (not cell.faces[f].has_neighbor)
+    const uint64_t fidx = face_base + f;
+    if (not mesh_view.face_has_neighbor[fidx])
     {
-      int ir_boundary_index = cell.faces[f].neighbor_id;
+      int ir_boundary_index = mesh_view.face_neighbor_ids[fidx];
       int ir_boundary_type  = boundaries[ir_boundary_index]->type;
 
       if (ir_boundary_type == DIFFUSION_DIRICHLET)
@@ -74,7 +78,7 @@ void chi_diffusion::Solver::CFEM_Assemble_A_and_b(chi_mesh::Cell& cell,
         auto dirichlet_bndry =
           (chi_diffusion::BoundaryDirichlet*)boundaries[ir_boundary_index];
 
-        int num_face_dofs = cell.faces[f].vertex_ids.size();
+        int num_face_dofs = mesh_view.NumFaceVertices(fidx);
         for (int fi=0; fi<num_face_dofs; fi++)
         {
           int i  = fe_intgrl_values.FaceDofMapping(f,fi);
@@ -88,7 +92,7 @@ void chi_diffusion::Solver::CFEM_Assemble_A_and_b(chi_mesh::Cell& cell,
         auto robin_bndry =
           (chi_diffusion::BoundaryRobin*)boundaries[ir_boundary_index];
 
-        int num_face_dofs = cell.faces[f].vertex_ids.size();
+        int num_face_dofs = mesh_view.NumFaceVertices(fidx);
         for (int fi=0; fi<num_face_dofs; fi++)
         {
           int i  = fe_intgrl_values.FaceDofMapping(f,fi);
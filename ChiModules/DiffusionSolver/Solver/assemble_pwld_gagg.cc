@@ -58,19 +58,27 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(const chi_mesh::Cell& cel
     }//for i
 
     //========================================= Loop over faces
-    int num_faces = cell.faces.size();
+    //Face data comes from the grid's packed view. Local neighbors are
+    //addressed by local id, only ghosts go through the discretization.
+    const auto& mesh_view = grid->GetPackedView();
+    const uint64_t face_base = mesh_view.FaceIndex(cell.local_id, 0);
+    int num_faces = mesh_view.NumCellFaces(cell.local_id);
     for (unsigned int f=0; f<num_faces; f++)
     {
-      auto& face = cell.faces[f];
+      const uint64_t fidx = face_base + f;
+      const uint64_t* face_vids = mesh_view.FaceVertexIds(fidx);
 
       //================================== Get face normal
-      chi_mesh::Vector3 n  = face.normal;
+      chi_mesh::Vector3 n  = mesh_view.face_normals[fidx];
 
-      int num_face_dofs = face.vertex_ids.size();
+      int num_face_dofs = mesh_view.NumFaceVertices(fidx);
 
-      if (face.has_neighbor)
+      if (mesh_view.face_has_neighbor[fidx])
       {
-        const auto& adj_cell = pwl_sdm->GetNeighborCell(face.neighbor_id);
+        const int64_t adj_local_id = mesh_view.face_neighbor_local_ids[fidx];
+        const auto& adj_cell = (adj_local_id >= 0)?
+          grid->local_cells[adj_local_id] :
+          pwl_sdm->GetNeighborCell(mesh_view.face_neighbor_ids[fidx]);
         const auto& adj_fe_intgrl_values = pwl_sdm->GetUnitIntegrals(adj_cell);
 
         //========================= Get the current map to the adj cell's face
@@ -131,7 +139,7 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(const chi_mesh::Cell& cel
           {
             int j     = fe_intgrl_values.FaceDofMapping(f,fj);
             int jr    = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, gr);
-            int jmap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fj]);
+            int jmap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face_vids[fj]);
             int jrmap = pwl_sdm->MapDOF(adj_cell, jmap, unknown_manager, 0, gr);
 
             double aij = kappa* fe_intgrl_values.IntS_shapeI_shapeJ(f, i, j);
@@ -155,7 +163,7 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(const chi_mesh::Cell& cel
           {
             int j     = fe_intgrl_values.FaceDofMapping(f,fj);
             int jr    = pwl_sdm->MapDOF(cell, j, unknown_manager, 0, gr);
-            int jmap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fj]);
+            int jmap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face_vids[fj]);
             int jrmap = pwl_sdm->MapDOF(adj_cell, jmap, unknown_manager, 0, gr);
 
             double aij =
@@ -171,7 +179,7 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(const chi_mesh::Cell& cel
         {
           int i     = fe_intgrl_values.FaceDofMapping(f,fi);
           int ir    = pwl_sdm->MapDOF(cell, i, unknown_manager, 0, gr);
-          int imap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face.vertex_ids[fi]);
+          int imap  = MapCellLocalNodeIDFromGlobalID(adj_cell, face_vids[fi]);
           int irmap = pwl_sdm->MapDOF(adj_cell, imap, unknown_manager, 0, gr);
 
           for (int j=0; j<fe_intgrl_values.NumNodes(); j++)
@@ -190,7 +198,7 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(const chi_mesh::Cell& cel
       }//if not bndry
       else
       {
-        int ir_boundary_index = face.neighbor_id;
+        int ir_boundary_index = mesh_view.face_neighbor_ids[fidx];
         int ir_boundary_type  = boundaries[ir_boundary_index]->type;
 
         if (ir_boundary_type == DIFFUSION_DIRICHLET)
@@ -35,6 +35,7 @@ int chi_diffusion::Solver::Initialize(bool verbose)
 
   auto& region = regions.back();
   grid = region->GetGrid();
+  grid->EstablishNeighborIndices();
 
 
 
@@ -0,0 +1,162 @@
+#include "../k_eigenvalue_solver.h"
+
+#include <ChiTimer/chi_timer.h>
+
+#include <petscsnes.h>
+
+#include <iomanip>
+#include <chi_log.h>
+#include <chi_mpi.h>
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+extern ChiTimer chi_program_timer;
+
+using namespace LinearBoltzmann;
+
+namespace
+{
+//###################################################################
+/**Nonlinear residual of the k-eigenvalue problem. With the eigenvalue
+ * defined as the production of the flux, k(phi) = F(phi), the residual
+ * is r = phi - T(phi) where T(phi) is the flux obtained by solving all
+ * groupsets with the fission source of phi divided by k(phi).*/
+PetscErrorCode KEigenResidual(SNES snes, Vec x, Vec r, void* ctx)
+{
+  auto solver = (KEigenvalue::Solver*)ctx;
+
+  const PetscScalar* x_raw;
+  VecGetArrayRead(x, &x_raw);
+  std::copy(x_raw, x_raw + solver->phi_prev_local.size(),
+            solver->phi_prev_local.begin());
+  VecRestoreArrayRead(x, &x_raw);
+
+  solver->k_eff = solver->ComputeProduction(solver->phi_prev_local);
+  solver->phi_old_local = solver->phi_prev_local;
+  solver->SolveFixedFissionSource();
+
+  PetscScalar* r_raw;
+  VecGetArray(r, &r_raw);
+  for (size_t i=0; i<solver->phi_old_local.size(); ++i)
+    r_raw[i] = solver->phi_prev_local[i] - solver->phi_old_local[i];
+  VecRestoreArray(r, &r_raw);
+
+  return 0;
+}
+
+//###################################################################
+/**Prints the Newton iteration information.*/
+PetscErrorCode KEigenSNESMonitor(SNES snes, PetscInt it,
+                                 PetscReal fnorm, void* ctx)
+{
+  auto solver = (KEigenvalue::Solver*)ctx;
+
+  std::stringstream iter_info;
+  iter_info
+    << chi_program_timer.GetTimeString() << " "
+    << "  Newton Iteration " << std::setw(5) << it
+    << "  Residual " << std::setw(14) << fnorm
+    << "  k_eff " << std::setw(10) << solver->k_eff;
+  chi_log.Log(LOG_0) << iter_info.str();
+
+  return 0;
+}
+}//namespace
+
+//###################################################################
+/**Jacobian-free Newton-Krylov scheme for k-eigenvalue calculations.
+ * A few power iterations provide the initial guess after which the
+ * nonlinear residual of KEigenResidual is driven to zero with Newton's
+ * method. The Jacobian-vector products are finite differences of the
+ * residual, hence every Krylov iteration costs one fixed fission source
+ * solve of all groupsets.*/
+void KEigenvalue::Solver::NewtonKrylovIteration()
+{
+  //============================================= Initial guess
+  const int max_iterations = options.max_iterations;
+  options.max_iterations = jfnk_power_iterations;
+  PowerIteration();
+  options.max_iterations = max_iterations;
+
+  chi_log.Log(LOG_0)
+    << "\n\n";
+  chi_log.Log(LOG_0)
+    << "********** Solving k-eigenvalue problem with "
+    << "Jacobian-free Newton-Krylov.\n\n";
+
+  //Scale the flux such that its production is the eigenvalue
+  double production = ComputeProduction(phi_prev_local);
+  for (auto& value : phi_prev_local)
+    value *= k_eff/production;
+
+  //============================================= Create vectors
+  Vec x, r;
+  VecCreate(PETSC_COMM_WORLD, &x);
+  VecSetSizes(x, static_cast<PetscInt>(phi_prev_local.size()),
+              PETSC_DETERMINE);
+  VecSetType(x, VECMPI);
+  VecDuplicate(x, &r);
+
+  PetscScalar* x_raw;
+  VecGetArray(x, &x_raw);
+  std::copy(phi_prev_local.begin(), phi_prev_local.end(), x_raw);
+  VecRestoreArray(x, &x_raw);
+
+  //============================================= Create nonlinear solver
+  SNES snes;
+  SNESCreate(PETSC_COMM_WORLD, &snes);
+  SNESSetType(snes, SNESNEWTONLS);
+  SNESSetFunction(snes, r, KEigenResidual, this);
+
+  Mat J;
+  MatCreateSNESMF(snes, &J);
+  SNESSetJacobian(snes, J, J, MatMFFDComputeJacobian, nullptr);
+
+  SNESSetTolerances(snes, 1.0e-50, options.tolerance, PETSC_DEFAULT,
+                    options.max_iterations, PETSC_DEFAULT);
+  SNESMonitorSet(snes, KEigenSNESMonitor, this, nullptr);
+
+  KSP ksp;
+  SNESGetKSP(snes, &ksp);
+  KSPSetType(ksp, KSPGMRES);
+  PC pc;
+  KSPGetPC(ksp, &pc);
+  PCSetType(pc, PCNONE);
+
+  SNESSetFromOptions(snes);
+
+  //============================================= Solve
+  SNESSolve(snes, nullptr, x);
+
+  SNESConvergedReason reason;
+  SNESGetConvergedReason(snes, &reason);
+  PetscInt num_newton_its;
+  SNESGetIterationNumber(snes, &num_newton_its);
+
+  //============================================= Copy back the solution
+  const PetscScalar* x_sol;
+  VecGetArrayRead(x, &x_sol);
+  std::copy(x_sol, x_sol + phi_prev_local.size(), phi_prev_local.begin());
+  VecRestoreArrayRead(x, &x_sol);
+
+  k_eff = ComputeProduction(phi_prev_local);
+  phi_old_local = phi_prev_local;
+
+  if (reason > 0)
+    chi_log.Log(LOG_0)
+      << "\n**********\n"
+      << "Newton iterations converged.\n"
+      << "Iterations:   " << num_newton_its << "\n"
+      << "k_eff:        " << std::setprecision(6) << k_eff
+      << "\n**********\n";
+  else
+    chi_log.Log(LOG_0WARNING)
+      << "Newton iterations did not converge. Reason "
+      << static_cast<int>(reason) << " after "
+      << num_newton_its << " iterations.";
+
+  MatDestroy(&J);
+  SNESDestroy(&snes);
+  VecDestroy(&r);
+  VecDestroy(&x);
+}
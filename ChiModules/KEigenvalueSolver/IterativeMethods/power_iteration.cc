@@ -10,55 +10,36 @@
 extern ChiLog& chi_log;
 extern ChiMPI& chi_mpi;
 
-namespace sweep_namespace = chi_mesh::sweep_management;
-typedef sweep_namespace::SweepChunk SweepChunk;
-typedef sweep_namespace::SweepScheduler MainSweepScheduler;
-typedef sweep_namespace::SchedulingAlgorithm SchedulingAlgorithm;
-
 extern ChiTimer chi_program_timer;
 
 using namespace LinearBoltzmann;
 
 //###################################################################
-/**Power iterative scheme for k-eigenvalue calculations.
- * Note that this routine currently only works when the problem 
- * is defined by a single groupset.
+/**Power iterative scheme for k-eigenvalue calculations. All groupsets
+ * are solved in turn for each fission source, using the latest flux of
+ * the other groupsets (Gauss-Seidel). With the Wielandt method the
+ * eigenvalue is shifted to k_eff + wielandt_shift on every outer
+ * iteration, which lowers the dominance ratio at the cost of more
+ * source iterations per outer iteration.
 */
-void KEigenvalue::Solver::PowerIteration(int groupset_num)
+void KEigenvalue::Solver::PowerIteration()
 {
+  const bool wielandt = (method == KEigenMethod::WIELANDT);
+
   chi_log.Log(LOG_0)
     << "\n\n";
   chi_log.Log(LOG_0)
     << "********** Solving k-eigenvalue problem with "
-    << "the Power Method.\n\n";
-
-  // ----- Obtain groupset
-  LBSGroupset& groupset = group_sets[groupset_num];
-  int groupset_numgrps = groupset.groups.size();
-  chi_log.Log(LOG_0)
-    << "Quadrature number of angles: "
-    << groupset.quadrature->abscissae.size() << "\n"
-    << "Groups " << groupset.groups.front().id << " "
-    << groupset.groups.back().id << "\n\n";
-
-  // ----- Setting up required sweep chunks
-  SweepChunk* sweep_chunk = SetSweepChunk(groupset);
-
-  // ----- Set sweep scheduler
-  MainSweepScheduler SweepScheduler(SchedulingAlgorithm::DEPTH_OF_GRAPH,
-                                    &groupset.angle_agg);
-
-  // ----- Tool the sweep chunk
-  sweep_chunk->SetDestinationPhi(&phi_new_local);
+    << ((wielandt)? "Wielandt-shifted power iteration.\n\n" :
+                    "the Power Method.\n\n");
 
   // ----- Set starting guess to a unit magnitude flux
   phi_prev_local.assign(phi_prev_local.size(),1.0);
-  DisAssembleVectorLocalToLocal(groupset,phi_prev_local.data(),
-                                         phi_old_local.data()); 
+  phi_old_local = phi_prev_local;
 
   // ----- Start outer k iterations
   double F_new = 0.0;
-  double F_prev = 1.0;
+  double F_prev = ComputeProduction(phi_prev_local);
   double k_eff_prev = k_eff;
   double k_eff_change = 0.0;
   double reactivity = 0.0;
@@ -67,30 +48,101 @@ void KEigenvalue::Solver::PowerIteration(int groupset_num)
 
   while (nit < options.max_iterations)
   {
+    if (wielandt) k_shift = k_eff + wielandt_shift;
+
+    // ----- Converge the scattering source for this fission source
+    nit += SolveFixedFissionSource();
+
+    // ----- Recompute eigenvalue
+    F_new = ComputeProduction(phi_old_local);
+    if (wielandt)
+    {
+      double mu = 1.0/(1.0/k_eff - 1.0/k_shift);
+      mu *= F_new/F_prev;
+      k_eff = 1.0/(1.0/mu + 1.0/k_shift);
+    }
+    else
+      k_eff = F_new/F_prev * k_eff;
+    reactivity = (k_eff - 1.0) / k_eff;
+
+    // ----- Compute convergence parameters and bump values
+    k_eff_change = fabs(k_eff - k_eff_prev) / k_eff;
+    k_eff_prev = k_eff; F_prev = F_new;
+    phi_prev_local = phi_old_local;
+                                          
+    if (k_eff_change<std::max(options.tolerance, 1.0e-12))
+      k_converged = true;    
+
+    // ----- Print iteration summary
+    if (verbose) {
+      std::stringstream k_iter_info;
+      k_iter_info
+        << chi_program_timer.GetTimeString() << " "
+        << "  Iteration " << std::setw(5) << nit
+        << "  k_eff " << std::setw(10) << k_eff
+        << "  k_eff change " << std::setw(10) << k_eff_change
+        << "  reactivity " << std::setw(10) << reactivity * 1e5;
+      if (k_converged) {
+        k_iter_info << " CONVERGED\n";
+      }
+      chi_log.Log(LOG_0) << k_iter_info.str();
+    }
+
+    if (k_converged) break;
+
+  }//for k iterations
+
+  k_shift = 0.0;
+}
+
+//###################################################################
+/**Performs source iterations on every groupset, in order, for the
+ * fission source of phi_prev_local and k_eff. On return phi_old_local
+ * holds the flux of all groupsets. Returns the number of sweeps.*/
+int KEigenvalue::Solver::SolveFixedFissionSource()
+{
+  int num_sweeps = 0;
+  for (int gs=0; gs<group_sets.size(); ++gs)
+  {
+    LBSGroupset& groupset = group_sets[gs];
+    SweepChunk* sweep_chunk = sweep_chunks[gs];
+    MainSweepScheduler& SweepScheduler = *sweep_schedulers[gs];
+    auto& anderson = andersons[gs];
+
     if (verbose)
       chi_log.Log(LOG_0) << "\n********** Starting source iterations";
 
-
     // ----- Start inner source iterations
     double pw_change = 0.0;
     double pw_change_prev = 1.0;
     double rho = 0.0;
     bool si_converged = false;
+    if (anderson) anderson->Reset(); //The fission source changed
     for (int si_nit=0; si_nit<groupset.max_iterations; si_nit++)
     {
       // ----- Set source and sweep
-      SetKSource(groupset_num, SourceFlags::USE_MATERIAL_SOURCE);
+      SetKSource(gs, SourceFlags::USE_MATERIAL_SOURCE);
       groupset.angle_agg.ZeroOutgoingDelayedPsi();
       phi_new_local.assign(phi_new_local.size(),0.0);
       SweepScheduler.Sweep(sweep_chunk);
 
-      // ----- Compute convergence parameters
-      pw_change = ComputePiecewiseChange(groupset);
-      DisAssembleVectorLocalToLocal(groupset,phi_new_local.data(),
-                                             phi_old_local.data());
+      // ----- Compute convergence parameters. The phi_old update is
+      //       fused with the metrics unless the iterate is mixed, in
+      //       which case the mixing overlaps the reduction
+      ConvergenceReduction reduction;
+      PostSweepUpdate(groupset, reduction, not anderson);
+      reduction.Start();
+      if (anderson)
+      {
+        anderson->Mix(phi_old_local, phi_new_local);
+        DisAssembleVectorLocalToLocal(groupset,phi_new_local.data(),
+                                               phi_old_local.data());
+      }
+      reduction.Wait();
+      pw_change = reduction.Max(0);
       rho = sqrt(pw_change/pw_change_prev);
       pw_change_prev = pw_change;
-      nit += 1;
+      num_sweeps += 1;
 
       if (si_nit==0) rho = 0.0;
       if (pw_change<std::max(groupset.residual_tolerance*rho,1.0e-10))
@@ -126,6 +178,7 @@ void KEigenvalue::Solver::PowerIteration(int groupset_num)
             << "\n**********\n";
         break;
       }
+      if (si_converged) break;
     }//for source iterations      
 
     if ((!si_converged) and (verbose)) {
@@ -135,71 +188,7 @@ void KEigenvalue::Solver::PowerIteration(int groupset_num)
           << "Final PW Change:   " << pw_change
           << "\n**********\n";
     }
+  }//for groupsets
 
-    // ----- Recompute eigenvalue
-    F_new = ComputeProduction();
-    k_eff = F_new/F_prev * k_eff;
-    reactivity = (k_eff - 1.0) / k_eff;
-
-    // ----- Compute convergence parameters and bump values
-    k_eff_change = fabs(k_eff - k_eff_prev) / k_eff;
-    k_eff_prev = k_eff; F_prev = F_new;
-    DisAssembleVectorLocalToLocal(groupset,phi_new_local.data(),
-                                           phi_prev_local.data());
-                                          
-    if (k_eff_change<std::max(options.tolerance, 1.0e-12))
-      k_converged = true;    
-
-    // ----- Print iteration summary
-    if (verbose) {
-      std::stringstream k_iter_info;
-      k_iter_info
-        << chi_program_timer.GetTimeString() << " "
-        << "  Iteration " << std::setw(5) << nit
-        << "  k_eff " << std::setw(10) << k_eff
-        << "  k_eff change " << std::setw(10) << k_eff_change
-        << "  reactivity " << std::setw(10) << reactivity * 1e5;
-      if (k_converged) {
-        k_iter_info << " CONVERGED\n";
-      }
-      chi_log.Log(LOG_0) << k_iter_info.str();
-    }
-
-    if (k_converged) break;
-
-  }//for k iterations
-  
-  double sweep_time = SweepScheduler.GetAverageSweepTime();
-  double source_time=
-    chi_log.ProcessEvent(source_event_tag,
-                         ChiLog::EventOperation::AVERAGE_DURATION);
-  size_t num_angles = groupset.quadrature->abscissae.size();
-  long int num_unknowns = (long int)glob_dof_count*
-                          (long int)num_angles*
-                          (long int)groupset.groups.size();
-  chi_log.Log(LOG_0)
-    << "\n\n";
-  chi_log.Log(LOG_0)
-    << "        Final k-eigenvalue    :        "
-    << std::setprecision(6) << k_eff;
-  chi_log.Log(LOG_0)
-    << "        Set Src Time/sweep (s):        "
-    << source_time;
-  chi_log.Log(LOG_0)
-    << "        Average sweep time (s):        "
-    << sweep_time;
-  chi_log.Log(LOG_0)
-    << "        Sweep Time/Unknown (ns):       "
-    << sweep_time*1.0e9*chi_mpi.process_count/num_unknowns;
-  chi_log.Log(LOG_0)
-    << "        Number of unknowns per sweep:  " << num_unknowns;
-  chi_log.Log(LOG_0)
-    << "\n\n";
-
-  std::string sweep_log_file_name =
-    std::string("GS_") + std::to_string(groupset_num) +
-    std::string("_SweepLog_") + std::to_string(chi_mpi.location_id) +
-    std::string(".log");
-  groupset.PrintSweepInfoFile(SweepScheduler.sweep_event_tag,sweep_log_file_name);
-  
+  return num_sweeps;
 }
@@ -12,6 +12,13 @@ using namespace LinearBoltzmann;
 //###################################################################
 /**Compute the total fission production in the problem.*/
 double KEigenvalue::Solver::ComputeProduction()
+{
+  return ComputeProduction(phi_new_local);
+}
+
+//###################################################################
+/**Compute the total fission production of the given flux moments.*/
+double KEigenvalue::Solver::ComputeProduction(const std::vector<double>& phi)
 {
   int first_grp = groups.front().id;
   int last_grp = groups.back().id;
@@ -33,7 +40,7 @@ double KEigenvalue::Solver::ComputeProduction()
     for (int i=0; i<cell_fe_view.NumNodes(); i++)
     {
       int ir = transport_view.MapDOF(i,0,0);
-      double* phi_newp = &phi_new_local[ir];
+      const double* phi_newp = &phi[ir];
 
       double intV_shapeI = cell_fe_view.IntV_shapeI(i);
 
@@ -52,6 +52,12 @@ void KEigenvalue::Solver::SetKSource(int groupset_num,
 
   std::vector<double> default_zero_src(groups.size(),0.0);
 
+  // ----- Fission weights. With a Wielandt shift k_s the part
+  //       phi_old/k_s is iterated with the scattering source.
+  const bool   shifted     = (k_shift > 0.0);
+  const double prev_weight = (shifted)? 1.0/k_eff - 1.0/k_shift : 1.0/k_eff;
+  const double old_weight  = (shifted)? 1.0/k_shift : 0.0;
+
   // ----- Reset source moments
   q_moments_local.assign(q_moments_local.size(),0.0);
 
@@ -131,10 +137,12 @@ void KEigenvalue::Solver::SetKSource(int groupset_num,
                 for (gprime=first_grp; gprime<=last_grp; ++gprime)
                   if (options.use_precursors)
                     fission_g += xs->chi_g[g]*xs->nu_p_sigma_fg[gprime]*
-                                phi_prevp[gprime]/k_eff;
+                                 (phi_prevp[gprime]*prev_weight +
+                                  phi_oldp[gprime]*old_weight);
                   else
                     fission_g += xs->chi_g[g]*xs->nu_sigma_fg[gprime]*
-                                 phi_prevp[gprime]/k_eff;
+                                 (phi_prevp[gprime]*prev_weight +
+                                  phi_oldp[gprime]*old_weight);
               }
             }
             q_mom[g] += fission_g;
@@ -151,7 +159,8 @@ void KEigenvalue::Solver::SetKSource(int groupset_num,
                   {
                     precursor_g += xs->chi_d[g][j]*xs->gamma[j]* 
                                    xs->nu_d_sigma_fg[gprime]*
-                                   phi_prevp[gprime]/k_eff;
+                                   (phi_prevp[gprime]*prev_weight +
+                                    phi_oldp[gprime]*old_weight);
                   }
                 }
               }
@@ -1,5 +1,7 @@
 #include "k_eigenvalue_solver.h"
 
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+
 #include <chi_mpi.h>
 #include <chi_log.h>
 
@@ -12,28 +14,113 @@ extern ChiLog&     chi_log;
 using namespace LinearBoltzmann;
 
 //###################################################################
+/**Initializes all groupsets, runs the selected k-eigenvalue method and
+ * cleans up the sweep structures again.*/
 void KEigenvalue::Solver::ExecuteKSolver()
 {
   MPI_Barrier(MPI_COMM_WORLD);
-  int gs = 0;
 
-  chi_log.Log(LOG_0)
-    << "\n********* Initializing Groupset " << gs << "\n" << std::endl;
+  source_event_tag = chi_log.GetRepeatingEventTag("Set Source");
+
+  //================================================== Initialize groupsets
+  for (int gs=0; gs<group_sets.size(); ++gs)
+  {
+    LBSGroupset& groupset = group_sets[gs];
+    InitializeGroupset(groupset, gs);
+
+    chi_log.Log(LOG_0)
+      << "Quadrature number of angles: "
+      << groupset.quadrature->abscissae.size() << "\n"
+      << "Groups " << groupset.groups.front().id << " "
+      << groupset.groups.back().id << "\n\n";
+
+    // ----- Setting up required sweep chunks
+    SweepChunk* sweep_chunk = SetSweepChunk(groupset);
+    sweep_chunk->SetDestinationPhi(&phi_new_local);
+    sweep_chunks.push_back(sweep_chunk);
 
-  group_sets[gs].BuildDiscMomOperator(options.scattering_order,
-                                      options.geometry_type);
-  group_sets[gs].BuildMomDiscOperator(options.scattering_order,
-                                      options.geometry_type);
-  group_sets[gs].BuildSubsets();
+    sweep_schedulers.push_back(std::unique_ptr<MainSweepScheduler>(
+      new MainSweepScheduler(groupset.sweep_scheduling_algorithm,
+                             &groupset.angle_agg)));
 
-  ComputeSweepOrderings(group_sets[gs]);
-  InitFluxDataStructures(group_sets[gs]);
+    // ----- Anderson acceleration of the source iterations
+    std::unique_ptr<AndersonAccelerator> anderson;
+    if (groupset.anderson_depth > 0)
+      anderson.reset(new AndersonAccelerator(
+        groupset.anderson_depth, GetGroupsetLocalIndices(groupset)));
+    andersons.push_back(std::move(anderson));
+  }
 
-  PowerIteration(gs);
+  //================================================== Solve
+  if (method == KEigenMethod::JFNK)
+    NewtonKrylovIteration();
+  else
+    PowerIteration();
 
-  ResetSweepOrderings(group_sets[gs]);
+  LogKSolverSummary();
+
+  //================================================== Clean up groupsets
+  for (auto sweep_chunk : sweep_chunks)
+    delete sweep_chunk;
+  sweep_chunks.clear();
+  sweep_schedulers.clear();
+  andersons.clear();
+
+  for (auto& groupset : group_sets)
+    CleanUpGroupset(groupset);
  
   chi_log.Log(LOG_0) << "k eigenvalue solver execution completed\n"; 
 
   MPI_Barrier(MPI_COMM_WORLD);
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Prints the final eigenvalue and sweep timing of all groupsets and
+ * writes the per groupset sweep logs.*/
+void KEigenvalue::Solver::LogKSolverSummary()
+{
+  double sweep_time = 0.0;
+  long int num_unknowns = 0;
+  for (int gs=0; gs<group_sets.size(); ++gs)
+  {
+    LBSGroupset& groupset = group_sets[gs];
+    sweep_time += sweep_schedulers[gs]->GetAverageSweepTime();
+
+    size_t num_angles = groupset.quadrature->abscissae.size();
+    num_unknowns += (long int)glob_dof_count*
+                    (long int)num_angles*
+                    (long int)groupset.groups.size();
+  }
+  double source_time=
+    chi_log.ProcessEvent(source_event_tag,
+                         ChiLog::EventOperation::AVERAGE_DURATION);
+
+  chi_log.Log(LOG_0)
+    << "\n\n";
+  chi_log.Log(LOG_0)
+    << "        Final k-eigenvalue    :        "
+    << std::setprecision(6) << k_eff;
+  chi_log.Log(LOG_0)
+    << "        Set Src Time/sweep (s):        "
+    << source_time;
+  chi_log.Log(LOG_0)
+    << "        Average sweep time (s):        "
+    << sweep_time;
+  chi_log.Log(LOG_0)
+    << "        Sweep Time/Unknown (ns):       "
+    << sweep_time*1.0e9*chi_mpi.process_count/num_unknowns;
+  chi_log.Log(LOG_0)
+    << "        Number of unknowns per sweep:  " << num_unknowns;
+  chi_log.Log(LOG_0)
+    << "\n\n";
+
+  for (int gs=0; gs<group_sets.size(); ++gs)
+  {
+    std::string sweep_log_file_name =
+      std::string("GS_") + std::to_string(gs) +
+      std::string("_SweepLog_") + std::to_string(chi_mpi.location_id) +
+      std::string(".log");
+    group_sets[gs].PrintSweepInfoFile(sweep_schedulers[gs]->sweep_event_tag,
+                                      sweep_log_file_name);
+  }
+}
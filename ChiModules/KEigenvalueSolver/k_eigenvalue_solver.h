@@ -2,18 +2,33 @@
 #define _k_eigen_solver_h
 
 #include "LinearBoltzmannSolver/lbs_linear_boltzmann_solver.h"
+#include "LinearBoltzmannSolver/Tools/lbs_anderson.h"
 
 #include <string>
+#include <memory>
 
 namespace  LinearBoltzmann::KEigenvalue
 {
 
+/**Outer iteration schemes for the k-eigenvalue.*/
+enum class KEigenMethod
+{
+  POWER_ITERATION = 1, ///< Unaccelerated power iteration
+  WIELANDT        = 2, ///< Power iteration with a Wielandt shift
+  JFNK            = 3  ///< Jacobian-free Newton-Krylov
+};
+
 /**A k-eigenvalue neutron transport solver.*/
 class Solver : public LinearBoltzmann::Solver
 {
 private:
   size_t source_event_tag;
 
+  //Per groupset sweep tools, valid during ExecuteKSolver
+  std::vector<SweepChunk*>                          sweep_chunks;
+  std::vector<std::unique_ptr<MainSweepScheduler>>  sweep_schedulers;
+  std::vector<std::unique_ptr<AndersonAccelerator>> andersons;
+
 public:
   bool verbose = false;
 
@@ -22,16 +37,24 @@ public:
   
   double k_eff = 1.0;
 
+  KEigenMethod method = KEigenMethod::POWER_ITERATION;
+  double wielandt_shift = 0.1;   ///< Shifted eigenvalue is k_eff + shift
+  int    jfnk_power_iterations = 5; ///< Power iterations before Newton
+  double k_shift = 0.0;          ///< Active Wielandt shift. 0 when unshifted
+
   std::vector<double> phi_prev_local;
 
   // Iterative methods
-  void PowerIteration(int groupset_num);
+  void PowerIteration();
+  void NewtonKrylovIteration();
+  int  SolveFixedFissionSource();
   
   // Iterative operations
   void SetKSource(int groupset_num,
                   bool apply_mat_src=true,
                   bool suppress_phi_old=false);
   double ComputeProduction();
+  double ComputeProduction(const std::vector<double>& phi);
 
   std::vector<double>
   IntegrateVolume(std::vector<double> phi);
@@ -39,9 +62,10 @@ public:
   // Execute method
   void InitializeKSolver();
   void ExecuteKSolver();
+  void LogKSolverSummary();
   
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -5,3 +5,8 @@ RegisterFunction(chiKEigenvalueLBSExecute);
 RegisterFunction(chiLBSSetUsePrecursors);
 RegisterFunction(chiLBSSetMaxKIterations);
 RegisterFunction(chiLBSSetKTolerance);
+
+RegisterFunction(chiLBSSetKEigenMethod);
+RegisterConstant(KEIGEN_POWER_ITERATION, 1);
+RegisterConstant(KEIGEN_WIELANDT,        2);
+RegisterConstant(KEIGEN_JFNK,            3);
@@ -148,3 +148,98 @@ int chiLBSSetKTolerance(lua_State *L) {
 
   return 0;
 }
+
+//############################################################
+/**Sets the k-eigenvalue outer iteration method.
+
+\param SolverIndex int Handle to the solver.
+\param Method int Method to use. Can be one of the following:
+ - KEIGEN_POWER_ITERATION. Unaccelerated power iteration (default).
+ - KEIGEN_WIELANDT. Power iteration with a Wielandt shift. The optional
+   third argument is the shift added to k_eff on each outer iteration
+   (default 0.1).
+ - KEIGEN_JFNK. Jacobian-free Newton-Krylov. The optional third argument
+   is the number of power iterations used to build the initial guess
+   (default 5).*/
+int chiLBSSetKEigenMethod(lua_State *L) {
+  int num_args = lua_gettop(L);
+
+  if ((num_args != 2) and (num_args != 3))
+    LuaPostArgAmountError(__FUNCTION__, 2, num_args);
+  LuaCheckNilValue(__FUNCTION__, L, 2);
+
+  int solver_index = lua_tonumber(L, 1);
+  int method = lua_tointeger(L, 2);
+
+  // ----- Get pointer to solver
+  chi_physics::Solver *psolver;
+  KEigenvalue::Solver *solver;
+  try {
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<KEigenvalue::Solver *>(psolver);
+
+    if (not solver) {
+      chi_log.Log(LOG_ALLERROR)
+        << __FUNCTION__  << ": Incorrect solver-type."
+           " Cannot cast to KEigenvalue::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch (const std::out_of_range &o) {
+    chi_log.Log(LOG_ALLERROR)
+      << __FUNCTION__  << ": Invalid handle to solver";
+    exit(EXIT_FAILURE);
+  }
+
+  if (method == (int)KEigenvalue::KEigenMethod::POWER_ITERATION)
+  {
+    solver->method = KEigenvalue::KEigenMethod::POWER_ITERATION;
+    chi_log.Log(LOG_0) << "k-eigenvalue method set to power iteration.";
+  }
+  else if (method == (int)KEigenvalue::KEigenMethod::WIELANDT)
+  {
+    if (num_args == 3)
+    {
+      double shift = lua_tonumber(L, 3);
+      if (shift <= 0.0)
+      {
+        chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Wielandt shift must be > 0.0";
+        exit(EXIT_FAILURE);
+      }
+      solver->wielandt_shift = shift;
+    }
+    solver->method = KEigenvalue::KEigenMethod::WIELANDT;
+    chi_log.Log(LOG_0)
+      << "k-eigenvalue method set to Wielandt-shifted power iteration "
+      << "with shift " << solver->wielandt_shift;
+  }
+  else if (method == (int)KEigenvalue::KEigenMethod::JFNK)
+  {
+    if (num_args == 3)
+    {
+      int num_pi = lua_tointeger(L, 3);
+      if (num_pi < 0)
+      {
+        chi_log.Log(LOG_ALLERROR)
+          << __FUNCTION__ << ": Number of initial power iterations "
+          << "must be >= 0.";
+        exit(EXIT_FAILURE);
+      }
+      solver->jfnk_power_iterations = num_pi;
+    }
+    solver->method = KEigenvalue::KEigenMethod::JFNK;
+    chi_log.Log(LOG_0)
+      << "k-eigenvalue method set to Jacobian-free Newton-Krylov with "
+      << solver->jfnk_power_iterations << " initial power iterations.";
+  }
+  else
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << __FUNCTION__ << ": Unknown k-eigenvalue method " << method;
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
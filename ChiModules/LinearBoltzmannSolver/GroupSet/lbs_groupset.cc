@@ -17,11 +17,16 @@ LBSGroupset::LBSGroupset()
   quadrature = nullptr;
   iterative_method = NPT_GMRES;
   angleagg_method  = LinearBoltzmann::AngleAggregationType::POLAR;
+  sweep_chunk_type = LinearBoltzmann::SweepChunkType::PWLD;
+  sweep_scheduling_algorithm =
+    chi_mesh::sweep_management::SchedulingAlgorithm::DEPTH_OF_GRAPH;
   master_num_grp_subsets = 1;
   master_num_ang_subsets = 1;
   residual_tolerance = 1.0e-6;
   max_iterations = 200;
   gmres_restart_intvl = 30;
+  krylov_type = LinearBoltzmann::KrylovType::GMRES;
+  anderson_depth = 0;
   apply_wgdsa = false;
   apply_tgdsa = false;
 
@@ -41,7 +46,13 @@ LBSGroupset::LBSGroupset()
 
   log_sweep_events = false;
 
+  sweep_num_threads = 1;
+  sweep_cache_max_mb = 0.0;
+  fluds_reorder_ties = false;
+  cache_fixed_source = true;
+
   latest_convergence_metric = 1.0;
+  convergence_check_interval = 1;
 }
 
 //###################################################################
@@ -3,6 +3,7 @@
 
 #include "lbs_group.h"
 #include "../IterativeMethods/lbs_iterativemethods.h"
+#include "../IterativeOperations/lbs_source_csr.h"
 
 #include <ChiMath/Quadratures/LegendrePoly/legendrepoly.h>
 #include <ChiMath/Quadratures/angular_quadrature_base.h>
@@ -21,6 +22,19 @@ namespace LinearBoltzmann
     SINGLE = 1,
     POLAR = 2
   };
+
+  enum class SweepChunkType
+  {
+    PWLD = 1,               ///< Solves groups one at a time
+    PWLD_GROUP_BATCHED = 2  ///< Solves all groups of a subset together
+  };
+
+  enum class KrylovType
+  {
+    GMRES      = 1, ///< Classical GMRES
+    PGMRES     = 2, ///< Pipelined GMRES, overlaps reductions with the sweep
+    PIPEFGMRES = 3  ///< Pipelined flexible GMRES
+  };
 }
 
 typedef chi_mesh::sweep_management::AngleAggregation AngleAgg;
@@ -51,9 +65,13 @@ public:
 
   int                                          iterative_method;
   LinearBoltzmann::AngleAggregationType        angleagg_method;
+  LinearBoltzmann::SweepChunkType              sweep_chunk_type;
+  chi_mesh::sweep_management::SchedulingAlgorithm sweep_scheduling_algorithm;
   double                                       residual_tolerance;
   int                                          max_iterations;
   int                                          gmres_restart_intvl;
+  LinearBoltzmann::KrylovType                  krylov_type;
+  int                                          anderson_depth;
   bool                                         apply_wgdsa;
   bool                                         apply_tgdsa;
   int                                          wgdsa_max_iters;
@@ -72,8 +90,16 @@ public:
   std::vector<int>                             wgdsa_cell_dof_array_address;
 
   bool                                         log_sweep_events;
+  int                                          sweep_num_threads;
+  double                                       sweep_cache_max_mb;
+  bool                                         fluds_reorder_ties;
+  bool                                         cache_fixed_source;
 
   double                                       latest_convergence_metric;
+  int                                          convergence_check_interval;
+
+  ///Flattened transfer matrices per cross-section id, see SetSource
+  std::vector<LinearBoltzmann::GroupsetSourceCSR> source_csr;
 
   /**
    * Convenient typdef for the moment call back function. See moment_callbacks.
@@ -81,12 +81,29 @@ void LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
   VecSet(phi_new,0.0);
   VecDuplicate(phi_new,&phi_old);
   VecDuplicate(phi_new,&q_fixed);
-  VecDuplicate(phi_new,&data_context.x_temp);
+
+  //Without delayed angular unknowns and with all groups in the groupset
+  //the Krylov vector layout is that of phi_new_local, hence the result of
+  //the matrix action is used in place. phi_new_local is never resized
+  //during the solve.
+  data_context.x_temp_wraps_phi_new = IsGroupsetContiguous(groupset) and
+                                      (num_ang_unknowns.second == 0);
+  if (data_context.x_temp_wraps_phi_new)
+    VecCreateMPIWithArray(PETSC_COMM_WORLD,1,
+                          local_size,globl_size,
+                          phi_new_local.data(),&data_context.x_temp);
+  else
+    VecDuplicate(phi_new,&data_context.x_temp);
 
   //================================================== Create Krylov Solver
   KSP ksp;
   KSPCreate(PETSC_COMM_WORLD, &ksp);
-  KSPSetType(ksp,KSPGMRES);
+  if      (groupset.krylov_type == KrylovType::PGMRES)
+    KSPSetType(ksp,KSPPGMRES);
+  else if (groupset.krylov_type == KrylovType::PIPEFGMRES)
+    KSPSetType(ksp,KSPPIPEFGMRES);
+  else
+    KSPSetType(ksp,KSPGMRES);
   KSPSetOperators(ksp,A,A);
   data_context.krylov_solver = ksp;
 
@@ -155,6 +172,16 @@ void LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
   KSPSolve(ksp,q_fixed,phi_new);
   //****************************************************
 
+  double avg_matvec_time = 0.0;
+  double avg_krylov_time = 0.0;
+  if (data_context.num_timed_iterations > 0)
+  {
+    avg_matvec_time = data_context.total_matvec_time/
+                      data_context.num_timed_iterations/1000.0;
+    avg_krylov_time = data_context.total_krylov_time/
+                      data_context.num_timed_iterations/1000.0;
+  }
+
   KSPConvergedReason reason;
   KSPGetConvergedReason(ksp,&reason);
   if (reason != KSP_CONVERGED_RTOL)
@@ -178,6 +205,18 @@ void LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
 
   double sweep_time = sweepScheduler.GetAverageSweepTime();
   double chunk_overhead_ratio = 1.0-sweepScheduler.GetAngleSetTimings()[2];
+  double local_wait_time = sweepScheduler.GetAverageWaitTime();
+  double max_wait_time = 0.0;
+  MPI_Allreduce(&local_wait_time, &max_wait_time, 1, MPI_DOUBLE,
+                MPI_MAX, MPI_COMM_WORLD);
+  auto local_message_stats = sweepScheduler.GetAverageMessageStatistics();
+  double local_messages[2] = {local_message_stats.first,
+                              local_message_stats.second};
+  double total_messages[2] = {0.0, 0.0};
+  MPI_Allreduce(local_messages, total_messages, 2, MPI_DOUBLE,
+                MPI_SUM, MPI_COMM_WORLD);
+  double predicted_efficiency = sweepScheduler.GetPredictedSweepEfficiency();
+  double measured_efficiency  = sweepScheduler.GetMeasuredSweepEfficiency();
   double source_time=
     chi_log.ProcessEvent(source_event_tag,
                          ChiLog::EventOperation::AVERAGE_DURATION);
@@ -196,9 +235,31 @@ void LinearBoltzmann::Solver::GMRES(LBSGroupset& groupset,
     chi_log.Log(LOG_0)
       << "        Average sweep time (s):        "
       << sweep_time;
+    chi_log.Log(LOG_0)
+      << "        Max angleset wait/sweep (s):   "
+      << max_wait_time;
+    chi_log.Log(LOG_0)
+      << "        Messages/sweep:                "
+      << total_messages[0];
+    chi_log.Log(LOG_0)
+      << "        Message MB/sweep:              "
+      << total_messages[1]/1.0e6;
+    if (predicted_efficiency > 0.0)
+      chi_log.Log(LOG_0)
+        << "        Predicted sweep efficiency:    "
+        << predicted_efficiency;
+    chi_log.Log(LOG_0)
+      << "        Measured sweep efficiency:     "
+      << measured_efficiency;
     chi_log.Log(LOG_0)
       << "        Chunk-Overhead-Ratio  :        "
       << chunk_overhead_ratio;
+    chi_log.Log(LOG_0)
+      << "        Matrix action time/its (s):    "
+      << avg_matvec_time;
+    chi_log.Log(LOG_0)
+      << "        Krylov time/its (s):           "
+      << avg_krylov_time;
     chi_log.Log(LOG_0)
       << "        Sweep Time/Unknown (ns):       "
       << sweep_time*1.0e9*chi_mpi.process_count/num_unknowns;
@@ -0,0 +1,98 @@
+#include "../lbs_linear_boltzmann_solver.h"
+
+#include <ChiTimer/chi_timer.h>
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+#include <iomanip>
+
+extern ChiTimer chi_program_timer;
+
+//###################################################################
+/**Iterates over all groupsets until the across-groupset coupling
+ * (upscatter and fission) has converged.
+ *
+ * All groupsets are initialized up front and keep their sweep
+ * structures for the duration of the iteration. With Gauss-Seidel each
+ * groupset uses the latest flux of the groupsets solved before it. With
+ * Jacobi every groupset is solved against the flux of the previous
+ * iteration, hence the groupset solves of an iteration are independent
+ * of each other and of their order.
+ *
+ * The Jacobi groupset solves are nonetheless run one after another.
+ * Solving them concurrently on separate teams of locations is not
+ * supported: every sweep uses MPI_COMM_WORLD and the solver-wide
+ * phi_old_local, phi_new_local and q_moments_local, so teams would
+ * first need their own communicators and flux storage.*/
+void LinearBoltzmann::Solver::AcrossGroupsetIterations()
+{
+  const bool jacobi = (options.ags_scheme == AGSScheme::JACOBI);
+
+  chi_log.Log(LOG_0)
+    << "\n********** Solving " << group_sets.size() << " groupsets with "
+    << ((jacobi)? "Jacobi" : "Gauss-Seidel")
+    << " across-groupset iterations.\n";
+
+  //================================================== Initialize groupsets
+  int gs=-1;
+  for (auto& groupset : group_sets)
+    InitializeGroupset(groupset, ++gs);
+
+  //================================================== Iterate
+  std::vector<double> phi_ags_prev_local;
+  std::vector<double> phi_jacobi_local;
+  bool converged = false;
+  for (int k=0; k<options.ags_max_iterations; ++k)
+  {
+    phi_ags_prev_local = phi_old_local;
+    if (jacobi) phi_jacobi_local = phi_old_local;
+
+    gs=-1;
+    for (auto& groupset : group_sets)
+    {
+      ++gs;
+      //Lag the across-groupset sources to the previous iteration
+      if (jacobi and gs > 0)
+        phi_old_local = phi_ags_prev_local;
+
+      SolveGroupset(groupset, gs);
+
+      if (jacobi)
+        DisAssembleVectorLocalToLocal(groupset, phi_old_local.data(),
+                                                phi_jacobi_local.data());
+    }
+    if (jacobi)
+    {
+      phi_old_local = phi_jacobi_local;
+      phi_new_local = phi_jacobi_local;
+    }
+
+    double pw_change = ComputeAGSPiecewiseChange(phi_ags_prev_local);
+    converged = (pw_change < std::max(options.ags_tolerance, 1.0e-10));
+
+    std::stringstream iter_info;
+    iter_info
+      << chi_program_timer.GetTimeString() << " "
+      << "AGS Iteration " << std::setw(5) << k
+      << " Point-wise change " << std::setw(14) << pw_change;
+    if (converged)
+      iter_info << " CONVERGED\n";
+    chi_log.Log(LOG_0) << iter_info.str();
+
+    if (converged) break;
+  }
+
+  if (not converged)
+    chi_log.Log(LOG_0WARNING)
+      << "Across-groupset iterations did not converge in "
+      << options.ags_max_iterations << " iterations.";
+
+  //================================================== Clean up groupsets
+  for (auto& groupset : group_sets)
+    CleanUpGroupset(groupset);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
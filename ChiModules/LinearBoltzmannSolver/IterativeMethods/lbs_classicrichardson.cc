@@ -2,6 +2,8 @@
 
 
 #include "../../DiffusionSolver/Solver/diffusion_solver.h"
+#include "../Tools/lbs_anderson.h"
+#include "../Tools/lbs_convergence_reduction.h"
 
 #include <ChiTimer/chi_timer.h>
 
@@ -12,6 +14,7 @@ extern ChiLog& chi_log;
 extern ChiMPI& chi_mpi;
 
 #include <iomanip>
+#include <cmath>
 
 extern ChiTimer chi_program_timer;
 
@@ -41,42 +44,48 @@ void LinearBoltzmann::Solver::
   //================================================== Tool the sweep chunk
   sweep_chunk->SetDestinationPhi(&phi_new_local);
 
+  //================================================== Anderson acceleration
+  std::unique_ptr<AndersonAccelerator> anderson;
+  if (groupset.anderson_depth > 0)
+  {
+    anderson.reset(new AndersonAccelerator(
+      groupset.anderson_depth, GetGroupsetLocalIndices(groupset)));
+    if (log_info)
+      chi_log.Log(LOG_0) << "Anderson acceleration with depth "
+                         << groupset.anderson_depth << ".";
+  }
+
+  //================================================== Convergence checks
+  //With an interval > 1 the metrics are only computed every
+  //check_interval iterations and their reduction overlaps the next sweep
+  const int check_interval = std::max(1, groupset.convergence_check_interval);
+  const bool lagged_check = (check_interval > 1);
+  ConvergenceReduction reduction;
+  int check_iteration = -1;
+  int prev_check_iteration = -1;
+
   //================================================== Now start iterating
   double pw_change = 0.0;
   double pw_change_prev = 1.0;
   double rho = 0.0;
   bool converged = false;
-  for (int k=0; k<groupset.max_iterations; k++)
-  {
-    SetSource(groupset,SourceFlags::USE_MATERIAL_SOURCE,false);
 
-    groupset.angle_agg.ZeroOutgoingDelayedPsi();
-
-    phi_new_local.assign(phi_new_local.size(),0.0); //Ensure phi_new=0.0
-    sweepScheduler.Sweep(sweep_chunk);
-
-    if (groupset.apply_wgdsa)
-    {
-      AssembleWGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
-      ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
-      DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
-    }
-    if (groupset.apply_tgdsa)
-    {
-      AssembleTGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
-      ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
-      DisAssembleTGDSADeltaPhiVector(groupset, phi_new_local.data());
-    }
-
-    pw_change = ComputePiecewiseChange(groupset);
-
-    DisAssembleVectorLocalToLocal(groupset,phi_new_local.data(),
-                                           phi_old_local.data());
-
-    rho = sqrt(pw_change/pw_change_prev);
+  auto EvaluateCheck = [&]()
+  {
+    reduction.Wait();
+    pw_change = reduction.Max(0);
+    double l2_change = std::sqrt(reduction.Sum(0));
+    double l2_norm   = std::sqrt(reduction.Sum(1));
+    reduction.Clear();
+
+    if (prev_check_iteration < 0)
+      rho = 0.0;
+    else
+      rho = std::pow(pw_change/pw_change_prev,
+                     0.5/(check_iteration - prev_check_iteration));
     pw_change_prev = pw_change;
+    prev_check_iteration = check_iteration;
 
-    if (k==0) rho = 0.0;
     if (pw_change<std::max(groupset.residual_tolerance*rho,1.0e-10))
       converged = true;
 
@@ -94,14 +103,71 @@ void LinearBoltzmann::Solver::
       << "-"
       << groupset.groups.back().id
       << "]"
-      << " Iteration " << std::setw(5) << k
-      << " Point-wise change " << std::setw(14) << pw_change;
+      << " Iteration " << std::setw(5) << check_iteration
+      << " Point-wise change " << std::setw(14) << pw_change
+      << " L2 change " << std::setw(14)
+      << ((l2_norm > 0.0)? l2_change/l2_norm : l2_change);
 
     if (converged)
       iter_info << " CONVERGED\n";
 
     if (log_info)
       chi_log.Log(LOG_0) << iter_info.str();
+  };
+
+  for (int k=0; k<groupset.max_iterations; k++)
+  {
+    SetSource(groupset,SourceFlags::USE_MATERIAL_SOURCE,false);
+
+    groupset.angle_agg.ZeroOutgoingDelayedPsi();
+
+    phi_new_local.assign(phi_new_local.size(),0.0); //Ensure phi_new=0.0
+    sweepScheduler.Sweep(sweep_chunk);
+
+    //======================================== Lagged check of the previous
+    //                                         iterate, phi_old is kept
+    if (reduction.Pending())
+    {
+      EvaluateCheck();
+      if (converged) break;
+    }
+
+    if (groupset.apply_wgdsa)
+    {
+      AssembleWGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
+      ((chi_diffusion::Solver*)groupset.wgdsa_solver)->ExecuteS(true,false);
+      DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
+    }
+    if (groupset.apply_tgdsa)
+    {
+      AssembleTGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
+      ((chi_diffusion::Solver*)groupset.tgdsa_solver)->ExecuteS(true,false);
+      DisAssembleTGDSADeltaPhiVector(groupset, phi_new_local.data());
+    }
+
+    //======================================== Metrics and phi_old update,
+    //                                         fused unless mixed
+    const bool check = ((k+1) % check_interval == 0) or
+                       (k+1 == groupset.max_iterations);
+    if (check)
+    {
+      PostSweepUpdate(groupset, reduction, not anderson);
+      check_iteration = k;
+      reduction.Start();
+    }
+
+    if (anderson)
+    {
+      anderson->Mix(phi_old_local, phi_new_local);
+      DisAssembleVectorLocalToLocal(groupset,phi_new_local.data(),
+                                             phi_old_local.data());
+    }
+    else if (not check)
+      DisAssembleVectorLocalToLocal(groupset,phi_new_local.data(),
+                                             phi_old_local.data());
+
+    if (check and (not lagged_check or k+1 == groupset.max_iterations))
+      EvaluateCheck();
 
     if (converged) break;
 
@@ -119,6 +185,18 @@ void LinearBoltzmann::Solver::
 
 
   double sweep_time = sweepScheduler.GetAverageSweepTime();
+  double local_wait_time = sweepScheduler.GetAverageWaitTime();
+  double max_wait_time = 0.0;
+  MPI_Allreduce(&local_wait_time, &max_wait_time, 1, MPI_DOUBLE,
+                MPI_MAX, MPI_COMM_WORLD);
+  auto local_message_stats = sweepScheduler.GetAverageMessageStatistics();
+  double local_messages[2] = {local_message_stats.first,
+                              local_message_stats.second};
+  double total_messages[2] = {0.0, 0.0};
+  MPI_Allreduce(local_messages, total_messages, 2, MPI_DOUBLE,
+                MPI_SUM, MPI_COMM_WORLD);
+  double predicted_efficiency = sweepScheduler.GetPredictedSweepEfficiency();
+  double measured_efficiency  = sweepScheduler.GetMeasuredSweepEfficiency();
   double source_time=
     chi_log.ProcessEvent(source_event_tag,
                          ChiLog::EventOperation::AVERAGE_DURATION);
@@ -137,6 +215,22 @@ void LinearBoltzmann::Solver::
     chi_log.Log(LOG_0)
       << "        Average sweep time (s):        "
       << sweep_time;
+    chi_log.Log(LOG_0)
+      << "        Max angleset wait/sweep (s):   "
+      << max_wait_time;
+    chi_log.Log(LOG_0)
+      << "        Messages/sweep:                "
+      << total_messages[0];
+    chi_log.Log(LOG_0)
+      << "        Message MB/sweep:              "
+      << total_messages[1]/1.0e6;
+    if (predicted_efficiency > 0.0)
+      chi_log.Log(LOG_0)
+        << "        Predicted sweep efficiency:    "
+        << predicted_efficiency;
+    chi_log.Log(LOG_0)
+      << "        Measured sweep efficiency:     "
+      << measured_efficiency;
     chi_log.Log(LOG_0)
       << "        Sweep Time/Unknown (ns):       "
       << sweep_time*1.0e9*chi_mpi.process_count/num_unknowns;
@@ -1,59 +1,144 @@
 #include "../lbs_linear_boltzmann_solver.h"
 #include <ChiMesh/Cell/cell.h>
 
+#include <cmath>
+#include <limits>
+
 //###################################################################
 /**Computes the point wise change between phi_new and phi_old.*/
 double LinearBoltzmann::Solver::ComputePiecewiseChange(LBSGroupset& groupset)
+{
+  ConvergenceReduction reduction;
+  PostSweepUpdate(groupset, reduction, false);
+  reduction.Start();
+  reduction.Wait();
+
+  return reduction.Max(0);
+}
+
+//###################################################################
+/**Single pass over the groupset entries of phi_new_local and
+ * phi_old_local after a sweep. Computes the local point-wise change and
+ * the squared L2 norms of phi_new - phi_old and of phi_new and, if
+ * copy_to_old is set, copies phi_new into phi_old in the same pass,
+ * which replaces a subsequent DisAssembleVectorLocalToLocal.
+ *
+ * Two metrics are added to the reduction: (point-wise change,
+ * |phi_new - phi_old|^2) followed by (0, |phi_new|^2). The index of the
+ * first is returned. The reduction itself is left to the caller so that
+ * it can be batched and overlapped.*/
+size_t LinearBoltzmann::Solver::
+  PostSweepUpdate(LBSGroupset& groupset,
+                  ConvergenceReduction& reduction,
+                  bool copy_to_old)
 {
   double pw_change = 0.0;
-  double sum_m0 = 0.0;
+  double l2_change = 0.0;
+  double l2_norm   = 0.0;
 
   int gsi = groupset.groups[0].id;
-  int gsf = groupset.groups.back().id;
   int deltag = groupset.groups.size();
 
+  std::vector<double> max_phi_m0(deltag, 0.0);
+
   for (const auto& cell : grid->local_cells)
   {
     auto& transport_view = cell_transport_views[cell.local_id];
 
     for (int i=0; i < cell.vertex_ids.size(); i++)
     {
+      //================================== Zeroth moment scale per group,
+      //                                   read before phi_old is updated
+      int map0 = transport_view.MapDOF(i,0,gsi);
+      for (int g=0; g<deltag; g++)
+        max_phi_m0[g] = std::max(std::fabs(phi_new_local[map0+g]),
+                                 std::fabs(phi_old_local[map0+g]));
+
       for (int m=0; m<num_moments; m++)
       {
         int mapping = transport_view.MapDOF(i,m,gsi);
-        double* phi_new_m = &phi_new_local.data()[mapping];
-        double* phi_old_m = &phi_old_local.data()[mapping];
+        double* phi_new_m = &phi_new_local[mapping];
+        double* phi_old_m = &phi_old_local[mapping];
 
         for (int g=0; g<deltag; g++)
         {
-          int map0 = transport_view.MapDOF(i,0,gsi+g);
-
-          double abs_phi_m0     = fabs(phi_new_local[map0]);
-          double abs_phi_old_m0 = fabs(phi_old_local[map0]);
-          double max_phi = std::max(abs_phi_m0,abs_phi_old_m0);
-
-          double delta_phi = std::fabs(phi_new_m[g] - phi_old_m[g]);
+          double delta = phi_new_m[g] - phi_old_m[g];
+          double delta_phi = std::fabs(delta);
 
-          if (max_phi >= std::numeric_limits<double>::min())
-            pw_change = std::max(delta_phi/max_phi,pw_change);
+          if (max_phi_m0[g] >= std::numeric_limits<double>::min())
+            pw_change = std::max(delta_phi/max_phi_m0[g],pw_change);
           else
             pw_change = std::max(delta_phi,pw_change);
 
+          l2_change += delta*delta;
+          l2_norm   += phi_new_m[g]*phi_new_m[g];
+
+          if (copy_to_old)
+            phi_old_m[g] = phi_new_m[g];
         }//for g
       }//for m
     }//for i
   }//for c
 
-//  const real8 abs_phi_0 = fabs(phi_0);
-//  const real8 abs_old_phi_0 = fabs(old_phi_0);
-//  const real8 maxv = std::max(abs_phi_0, abs_old_phi_0);
-//  const real8 diff = fabs(phi - old_phi);
-//  const real8 pw_change = (maxv >= std::numeric_limits<real8>::min()) ?
-//                          (diff / maxv) : diff;
+  size_t index = reduction.Add(pw_change, l2_change);
+  reduction.Add(0.0, l2_norm);
+
+  return index;
+}
 
-  double global_pw_change = 0.0;
+//###################################################################
+/**Computes the point wise change between phi_old and the flux of the
+ * previous across-groupset iteration over all groups. The zeroth moment
+ * scale of a node is read once and every moment is mapped once, after
+ * which the groups are contiguous. The global maximum uses the same
+ * fused reduction as the within-groupset convergence checks.*/
+double LinearBoltzmann::Solver::
+  ComputeAGSPiecewiseChange(const std::vector<double>& phi_prev_local)
+{
+  double pw_change = 0.0;
+  double l2_change = 0.0;
+  int num_groups = groups.size();
+
+  std::vector<double> max_phi_m0(num_groups, 0.0);
+
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& transport_view = cell_transport_views[cell.local_id];
+
+    for (int i=0; i < cell.vertex_ids.size(); i++)
+    {
+      //================================== Zeroth moment scale per group
+      int map0 = transport_view.MapDOF(i,0,0);
+      for (int g=0; g<num_groups; g++)
+        max_phi_m0[g] = std::max(std::fabs(phi_old_local[map0+g]),
+                                 std::fabs(phi_prev_local[map0+g]));
+
+      for (int m=0; m<num_moments; m++)
+      {
+        int mapping = transport_view.MapDOF(i,m,0);
+        const double* phi_m      = &phi_old_local[mapping];
+        const double* phi_prev_m = &phi_prev_local[mapping];
+
+        for (int g=0; g<num_groups; g++)
+        {
+          double delta = phi_m[g] - phi_prev_m[g];
+          double delta_phi = std::fabs(delta);
+
+          if (max_phi_m0[g] >= std::numeric_limits<double>::min())
+            pw_change = std::max(delta_phi/max_phi_m0[g],pw_change);
+          else
+            pw_change = std::max(delta_phi,pw_change);
+
+          l2_change += delta*delta;
+        }//for g
+      }//for m
+    }//for i
+  }//for c
 
-  MPI_Allreduce(&pw_change,&global_pw_change,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+  ConvergenceReduction reduction;
+  reduction.Add(pw_change, l2_change);
+  reduction.Start();
+  reduction.Wait();
 
-  return global_pw_change;
-}
\ No newline at end of file
+  return reduction.Max(0);
+}
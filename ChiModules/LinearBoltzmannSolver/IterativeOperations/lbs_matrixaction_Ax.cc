@@ -4,6 +4,10 @@
 
 #include "../../DiffusionSolver/Solver/diffusion_solver.h"
 
+#include "ChiTimer/chi_timer.h"
+
+extern ChiTimer chi_program_timer;
+
 typedef chi_mesh::sweep_management::SweepScheduler MainSweepScheduler;
 //###################################################################
 /**Computes the action of the transport matrix on a vector.*/
@@ -18,6 +22,8 @@ int LBSMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax)
   LBSGroupset& groupset  = *context->groupset;
   MainSweepScheduler* sweepScheduler = context->sweepScheduler;
 
+  double t_begin = chi_program_timer.GetTime();
+
   //============================================= Copy krylov vector into local
   solver->DisAssembleVector(groupset,
                             krylov_vector,
@@ -56,13 +62,18 @@ int LBSMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax)
   }
 
 
-  solver->AssembleVector(groupset,
-                         context->x_temp,
-                         solver->phi_new_local.data(),WITH_DELAYED_PSI);
+  if (context->x_temp_wraps_phi_new)
+    PetscObjectStateIncrease((PetscObject)context->x_temp);
+  else
+    solver->AssembleVector(groupset,
+                           context->x_temp,
+                           solver->phi_new_local.data(),WITH_DELAYED_PSI);
 
 
   //============================================= Computing action
   VecWAXPY(Ax,-1.0,context->x_temp,krylov_vector);
 
+  context->matvec_time += chi_program_timer.GetTime() - t_begin;
+
   return 0;
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 extern ChiMPI& chi_mpi;
 extern ChiLog& chi_log;
 
+#include <iomanip>
+
 //###################################################################
 /**Sets the source moments for the groups in the current group set.
  *
@@ -18,6 +20,16 @@ extern ChiLog& chi_log;
  *        On this note we also need to treat inscattering this way.
  * \param suppress_phi_old Flag indicating whether to suppress phi_old.
  *
+ * The material source, across-groupset and within-groupset scattering
+ * and fission are computed in a single pass over phi_old_local using the
+ * groupset's flattened transfer matrices. Cells are distributed over
+ * groupset.sweep_num_threads threads; every cell only writes its own
+ * source moments.
+ *
+ * With groupset.cache_fixed_source the material source and the
+ * across-groupset terms are stored in q_fixed_local on the first call
+ * with apply_mat_src of a groupset solve. Subsequent calls only add the
+ * within-groupset terms to the stored values.
  * */
 void LinearBoltzmann::Solver::SetSource(LBSGroupset& groupset,
                                         bool apply_mat_src,
@@ -34,24 +46,34 @@ void LinearBoltzmann::Solver::SetSource(LBSGroupset& groupset,
   int gs_i = groupset.groups[0].id;
   int gs_f = groupset.groups.back().id;
 
-  int first_grp = groups.front().id;
-  int last_grp = groups.back().id;
+  if (groupset.source_csr.size() != material_xs.size())
+    BuildGroupsetSourceCSR(groupset);
 
   std::vector<double> default_zero_src(groups.size(),0.0);
 
+  //================================================== Fixed source cache
+  const size_t num_all_groups = groups.size();
+  const size_t num_gs_groups  = gs_f - gs_i + 1;
+  const bool use_fixed   = apply_mat_src and groupset.cache_fixed_source;
+  const bool read_fixed  = use_fixed and (q_fixed_groupset == &groupset);
+  const bool write_fixed = use_fixed and (not read_fixed);
+  if (write_fixed)
+    q_fixed_local.assign(q_moments_local.size()/num_all_groups*num_gs_groups,
+                         0.0);
+
   //================================================== Reset source moments
   q_moments_local.assign(q_moments_local.size(),0.0);
 
-  //================================================== Loop over local cells
-  for (const auto& cell : grid->local_cells)
+  //================================================== Cell kernel
+  //Cross-section and source ids come from the transport views so that
+  //the loop does not touch the cell objects
+  auto CellSource = [&](size_t cell_local_id)
   {
-    auto& full_cell_view = cell_transport_views[cell.local_id];
+    auto& full_cell_view = cell_transport_views[cell_local_id];
 
     //=========================================== Obtain cross-section and src
-    int cell_matid = cell.material_id;
-
-    int xs_id = matid_to_xs_map[cell_matid];
-    int src_id= matid_to_src_map[cell_matid];
+    int xs_id = full_cell_view.xs_id;
+    int src_id= full_cell_view.src_id;
 
     if ((xs_id<0) || (xs_id>=material_xs.size()))
     {
@@ -60,20 +82,19 @@ void LinearBoltzmann::Solver::SetSource(LBSGroupset& groupset,
       exit(EXIT_FAILURE);
     }
 
-    auto xs = material_xs[xs_id];
+    const auto& csr = groupset.source_csr[xs_id];
 
     //=========================================== Obtain material source
-    double* src = default_zero_src.data();
+    const double* src = default_zero_src.data();
     if ( (src_id >= 0) && (apply_mat_src) )
       src = material_srcs[src_id]->source_value_g.data();
 
+    const bool across = apply_mat_src and (not read_fixed);
+    const bool fission = csr.is_fissile and
+                         (across or (not suppress_phi_old));
+
     //=========================================== Loop over dofs
-    double inscat_g = 0.0;
-    double sigma_sm = 0.0;
-    double* q_mom;
-    double* phi_oldp;
     int num_dofs = full_cell_view.dofs;
-    int gprime;
     for (int i=0; i<num_dofs; i++)
     {
       //==================================== Loop over moments
@@ -87,82 +108,154 @@ void LinearBoltzmann::Solver::SetSource(LBSGroupset& groupset,
         {
           m++;
           int ir = full_cell_view.MapDOF(i,m,0);
-          q_mom    = &q_moments_local[ir];
-          phi_oldp = &phi_old_local[ir];
+          double*       q_mom    = &q_moments_local[ir];
+          const double* phi_oldp = &phi_old_local[ir];
+          double*       q_fixed  = (use_fixed)?
+            &q_fixed_local[ir/num_all_groups*num_gs_groups] : nullptr;
+
+          //============================= Fission rates
+          double across_fission = 0.0;
+          double within_fission = 0.0;
+          if ((ell == 0) and fission)
+          {
+            const int num_xs_groups = csr.nu_sigma_f.size();
+            if (across)
+            {
+              for (int gprime=0; gprime<gs_i; ++gprime)
+                across_fission += csr.nu_sigma_f[gprime]*phi_oldp[gprime];
+              for (int gprime=gs_f+1; gprime<num_xs_groups; ++gprime)
+                across_fission += csr.nu_sigma_f[gprime]*phi_oldp[gprime];
+            }
+            if (not suppress_phi_old)
+              for (int gprime=gs_i; gprime<=gs_f; ++gprime)
+                within_fission += csr.nu_sigma_f[gprime]*phi_oldp[gprime];
+          }
 
           //============================= Loop over groupset groups
+          const bool has_transfers = (ell < csr.num_ell);
+          const int row_offset = ell*csr.num_groups - gs_i;
           for (int g=gs_i; g<=gs_f; g++)
           {
-            if (apply_mat_src && (m==0))
-              q_mom[g] += src[g];
-
+            const size_t row = row_offset + g;
+            double q_g = 0.0;
 
-            inscat_g = 0.0;
-            //====================== Apply across-groupset scattering
-            if ((ell < xs->transfer_matrix.size()) && (apply_mat_src) )
+            //====================== Fixed part
+            if (read_fixed)
+              q_g = q_fixed[g-gs_i];
+            else if (across)
             {
-              int num_transfers = xs->transfer_matrix[ell].rowI_indices[g].size();
-              for (int t=0; t<num_transfers; t++)
-              {
-                gprime    = xs->transfer_matrix[ell].rowI_indices[g][t];
-                if ((gprime < gs_i) || (gprime > gs_f))
-                {
-                  sigma_sm  = xs->transfer_matrix[ell].rowI_values[g][t];
-                  inscat_g += sigma_sm * phi_oldp[gprime];
-                }
-              }
-            }//if moment avail
-
-            //====================== Apply within-groupset scattering
-            if ((ell < xs->transfer_matrix.size()) && (!suppress_phi_old) )
-            {
-              int num_transfers = xs->transfer_matrix[ell].rowI_indices[g].size();
-              for (int t=0; t<num_transfers; t++)
-              {
-                gprime    = xs->transfer_matrix[ell].rowI_indices[g][t];
-                if ((gprime >= gs_i) && (gprime<=gs_f))
-                {
-                  sigma_sm  = xs->transfer_matrix[ell].rowI_values[g][t];
-                  inscat_g += sigma_sm * phi_oldp[gprime];
-                }
-              }
-            }//if moment avail
-
-            q_mom[g] += inscat_g;
-
-            //====================== Apply accross-groupset fission
-            if ((ell == 0) and (apply_mat_src))
-            {
-              for (gprime=first_grp; gprime<=last_grp; ++gprime)
-              {
-                if ((gprime < gs_i) || (gprime > gs_f))
-                {
-                  q_mom[g] += xs->chi_g[g]*
-                              xs->nu_sigma_fg[gprime]*
-                              phi_oldp[gprime];
-                }
-              }//for gprime
-            }//if zeroth moment
-
-            //====================== Apply within-groupset fission
-            if ((ell == 0) and (!suppress_phi_old))
+              if (m==0)
+                q_g += src[g];
+
+              //Across-groupset scattering
+              if (has_transfers)
+                for (size_t t = csr.across_row_start[row];
+                            t < csr.across_row_start[row+1]; ++t)
+                  q_g += csr.across_vals[t]*phi_oldp[csr.across_cols[t]];
+
+              //Across-groupset fission
+              if (ell == 0 and fission)
+                q_g += csr.chi[g-gs_i]*across_fission;
+
+              if (write_fixed)
+                q_fixed[g-gs_i] = q_g;
+            }
+
+            //====================== Within-groupset part
+            if (not suppress_phi_old)
             {
-              for (gprime=first_grp; gprime<=last_grp; ++gprime)
-              {
-                if ((gprime >= gs_i) && (gprime<=gs_f))
-                {
-                  q_mom[g] += xs->chi_g[g]*
-                              xs->nu_sigma_fg[gprime]*
-                              phi_oldp[gprime];
-                }
-              }//for gprime
-            }//if zeroth moment
+              if (has_transfers)
+                for (size_t t = csr.within_row_start[row];
+                            t < csr.within_row_start[row+1]; ++t)
+                  q_g += csr.within_vals[t]*phi_oldp[csr.within_cols[t]];
+
+              if (ell == 0 and fission)
+                q_g += csr.chi[g-gs_i]*within_fission;
+            }
+
+            q_mom[g] = q_g;
           }//for g
         }
 
       }//for moment
     }//for dof i
-  }//for cell
+  };
+
+  //================================================== Loop over local cells
+  const size_t num_cells = cell_transport_views.size();
+  size_t num_threads = std::max(1, groupset.sweep_num_threads);
+  if (num_threads == 1)
+  {
+    for (size_t c=0; c<num_cells; ++c)
+      CellSource(c);
+  }
+  else
+  {
+    if ((not source_thread_pool) or
+        (source_thread_pool->NumThreads() != num_threads))
+      source_thread_pool.reset(new ThreadPool(num_threads));
+
+    //Cells are handed out in blocks to keep the scheduling overhead low
+    const size_t block_size = 64;
+    const size_t num_blocks = (num_cells + block_size - 1)/block_size;
+    source_thread_pool->ParallelFor(num_blocks,
+      [&CellSource,num_cells,block_size](size_t block, size_t)
+      {
+        size_t c_end = std::min(num_cells, (block+1)*block_size);
+        for (size_t c=block*block_size; c<c_end; ++c)
+          CellSource(c);
+      });
+  }
+
+  if (write_fixed)
+    q_fixed_groupset = &groupset;
 
   chi_log.LogEvent(source_event_tag,ChiLog::EventType::EVENT_END);
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Flattens the transfer matrices of every cross-section set for the
+ * groups of the groupset. See GroupsetSourceCSR.*/
+void LinearBoltzmann::Solver::BuildGroupsetSourceCSR(LBSGroupset& groupset)
+{
+  int gs_i = groupset.groups.front().id;
+  int gs_f = groupset.groups.back().id;
+
+  groupset.source_csr.clear();
+  groupset.source_csr.reserve(material_xs.size());
+
+  size_t num_bytes = 0;
+  for (const auto& xs : material_xs)
+  {
+    groupset.source_csr.emplace_back(*xs, gs_i, gs_f,
+                                     options.scattering_order+1,
+                                     static_cast<int>(groups.size()));
+    num_bytes += groupset.source_csr.back().MemoryInBytes();
+  }
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "Groupset source transfer matrices flattened. Memory = "
+    << std::setprecision(3) << num_bytes/1024.0/1024.0 << " MB";
+}
+
+//###################################################################
+/**Logs the memory of the fixed source cache of a groupset relative to
+ * the source moments. The cache trades this memory for the across-groupset
+ * work of every source iteration after the first.*/
+void LinearBoltzmann::Solver::LogFixedSourceCache(LBSGroupset& groupset)
+{
+  if (not groupset.cache_fixed_source) return;
+
+  double num_gs_groups = groupset.groups.size();
+  double local_mb = q_moments_local.size()/(double)groups.size()*
+                    num_gs_groups*sizeof(double)/1024.0/1024.0;
+  double max_mb = 0.0;
+  MPI_Allreduce(&local_mb,&max_mb,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+
+  chi_log.Log(LOG_0)
+    << "Groupset fixed source cache (max per process) = "
+    << std::setprecision(3) << max_mb << " MB, "
+    << std::setprecision(3) << 100.0*num_gs_groups/groups.size()
+    << "% of the source moments. Disable with "
+    << "chiLBSGroupsetSetFixedSourceCache if memory bound.";
+}
@@ -1,5 +1,6 @@
 #include "../lbs_linear_boltzmann_solver.h"
 #include "../SweepChunks/lbs_sweepchunk_pwl.h"
+#include "../SweepChunks/lbs_sweepchunk_pwl_groupbatched.h"
 
 typedef chi_mesh::sweep_management::SweepChunk SweepChunk;
 
@@ -11,7 +12,19 @@ SweepChunk* LinearBoltzmann::Solver::SetSweepChunk(LBSGroupset& groupset)
 
   //================================================== Setting up required
   //                                                   sweep chunks
-  SweepChunk* sweep_chunk = new LBSSweepChunkPWL(
+  SweepChunk* sweep_chunk;
+  if (groupset.sweep_chunk_type == SweepChunkType::PWLD_GROUP_BATCHED)
+    sweep_chunk = new LBSSweepChunkPWLGroupBatched(
+        grid,                                    //Spatial grid of cells
+        *pwl_sdm,                                //Spatial discretization
+        cell_transport_views,                    //Cell transport views
+        &phi_new_local,                          //Destination phi
+        &q_moments_local,                        //Source moments
+        groupset,                                //Reference groupset
+        material_xs,                             //Material cross-sections
+        num_moments,max_cell_dof_count);
+  else
+    sweep_chunk = new LBSSweepChunkPWL(
         grid,                                    //Spatial grid of cells
         *pwl_sdm,                                //Spatial discretization
         cell_transport_views,                    //Cell transport views
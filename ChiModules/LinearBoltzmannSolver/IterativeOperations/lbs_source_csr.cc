@@ -0,0 +1,79 @@
+#include "lbs_source_csr.h"
+
+#include "ChiPhysics/PhysicsMaterial/transportxsections/material_property_transportxsections.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Flattens the transfer matrices and fission data of xs for the
+ * groups [in_gs_i, in_gs_f]. Only the first max_num_ell scattering
+ * orders are stored. Transfers from, and production of, groups at or
+ * beyond num_solver_groups are dropped since the solver holds no flux
+ * for them.*/
+LinearBoltzmann::GroupsetSourceCSR::
+  GroupsetSourceCSR(const chi_physics::TransportCrossSections& xs,
+                    int in_gs_i, int in_gs_f, int max_num_ell,
+                    int num_solver_groups) :
+  gs_i(in_gs_i),
+  gs_f(in_gs_f)
+{
+  num_groups = gs_f - gs_i + 1;
+  num_ell = std::min(static_cast<int>(xs.transfer_matrix.size()),
+                     max_num_ell);
+  num_ell = std::max(num_ell, 0);
+
+  //============================================= Transfer matrices
+  within_row_start.reserve(num_ell*num_groups + 1);
+  across_row_start.reserve(num_ell*num_groups + 1);
+  within_row_start.push_back(0);
+  across_row_start.push_back(0);
+  for (int ell=0; ell<num_ell; ++ell)
+  {
+    const auto& matrix = xs.transfer_matrix[ell];
+    for (int g=gs_i; g<=gs_f; ++g)
+    {
+      const auto& row_indices = matrix.rowI_indices[g];
+      const auto& row_values  = matrix.rowI_values[g];
+      for (size_t t=0; t<row_indices.size(); ++t)
+      {
+        auto gprime = static_cast<int>(row_indices[t]);
+        if (gprime >= num_solver_groups) continue;
+        if ((gprime >= gs_i) and (gprime <= gs_f))
+        {
+          within_cols.push_back(gprime);
+          within_vals.push_back(row_values[t]);
+        }
+        else
+        {
+          across_cols.push_back(gprime);
+          across_vals.push_back(row_values[t]);
+        }
+      }
+      within_row_start.push_back(within_cols.size());
+      across_row_start.push_back(across_cols.size());
+    }
+  }
+
+  //============================================= Fission
+  if (xs.chi_g.size() > gs_f)
+    chi.assign(xs.chi_g.begin() + gs_i, xs.chi_g.begin() + gs_f + 1);
+  const size_t num_nu_sigma_f = std::min(xs.nu_sigma_fg.size(),
+                                         static_cast<size_t>(num_solver_groups));
+  nu_sigma_f.assign(xs.nu_sigma_fg.begin(),
+                    xs.nu_sigma_fg.begin() + num_nu_sigma_f);
+
+  auto NonZero = [](double value){return value != 0.0;};
+  is_fissile = (not chi.empty()) and
+               std::any_of(chi.begin(), chi.end(), NonZero) and
+               std::any_of(nu_sigma_f.begin(), nu_sigma_f.end(), NonZero);
+}
+
+//###################################################################
+/**Returns the number of bytes held by the flattened arrays.*/
+size_t LinearBoltzmann::GroupsetSourceCSR::MemoryInBytes() const
+{
+  return (within_row_start.size() + across_row_start.size())*sizeof(size_t) +
+         (within_cols.size() + across_cols.size())*sizeof(int) +
+         (within_vals.size() + across_vals.size() +
+          chi.size() + nu_sigma_f.size())*sizeof(double);
+}
@@ -0,0 +1,57 @@
+#ifndef LBS_SOURCE_CSR_H
+#define LBS_SOURCE_CSR_H
+
+#include <vector>
+#include <cstddef>
+
+namespace chi_physics
+{
+  class TransportCrossSections;
+}
+
+namespace LinearBoltzmann
+{
+  struct GroupsetSourceCSR;
+}
+
+//###################################################################
+/**Scattering and fission data of one cross-section set, flattened for
+ * the groups of a single groupset.
+ *
+ * The transfer matrices are stored as one CSR matrix with a row for
+ * every (moment, groupset group) pair, row = ell*num_groups + g - gs_i.
+ * Transfers originating from groups inside the groupset (within) and
+ * from groups outside of it (across) are held in separate arrays so
+ * that the source kernel needs no range checks. Fission is stored as
+ * the spectrum of the groupset groups and the production cross-section
+ * of all solver groups, which reduces the fission source to one
+ * fission rate per dof. Data of cross-section groups beyond the
+ * solver's groups is dropped.*/
+struct LinearBoltzmann::GroupsetSourceCSR
+{
+  int num_ell    = 0;   ///< Number of scattering orders stored
+  int num_groups = 0;   ///< Number of groups in the groupset
+  int gs_i       = 0;   ///< First group of the groupset
+  int gs_f       = -1;  ///< Last group of the groupset
+
+  std::vector<size_t> within_row_start;  ///< Size num_ell*num_groups+1
+  std::vector<int>    within_cols;       ///< Global group indices
+  std::vector<double> within_vals;
+
+  std::vector<size_t> across_row_start;  ///< Size num_ell*num_groups+1
+  std::vector<int>    across_cols;       ///< Global group indices
+  std::vector<double> across_vals;
+
+  bool                is_fissile = false;
+  std::vector<double> chi;               ///< Spectrum, groupset groups
+  std::vector<double> nu_sigma_f;        ///< Production, solver groups
+
+  GroupsetSourceCSR() = default;
+  GroupsetSourceCSR(const chi_physics::TransportCrossSections& xs,
+                    int in_gs_i, int in_gs_f, int max_num_ell,
+                    int num_solver_groups);
+
+  size_t MemoryInBytes() const;
+};
+
+#endif
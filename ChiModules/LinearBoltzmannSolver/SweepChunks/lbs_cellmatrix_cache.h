@@ -0,0 +1,106 @@
+#ifndef LBS_CELLMATRIX_CACHE_H
+#define LBS_CELLMATRIX_CACHE_H
+
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+namespace LinearBoltzmann
+{
+  class CellMatrixCache;
+}
+
+//###################################################################
+/**Memory-budgeted store of dense per-cell, per-angle (and optionally
+ * per-group) cell matrices that do not change between sweeps.
+ *
+ * Storage is assigned at initialization to cells in local-id order until
+ * the memory budget is exhausted, therefore lookups never allocate and
+ * distinct cells can be filled concurrently. Each entry holds a
+ * num_nodes x num_nodes row-major matrix.*/
+class LinearBoltzmann::CellMatrixCache
+{
+private:
+  static constexpr size_t NOT_CACHED = std::numeric_limits<size_t>::max();
+
+  size_t              num_angles = 0;
+  size_t              num_groups = 0;
+  std::vector<size_t> cell_offset;      ///< Start of the cell's block
+  std::vector<size_t> cell_entry_size;  ///< num_nodes^2
+  std::vector<size_t> cell_flag_offset; ///< Start of the cell's fill flags
+  std::vector<double> storage;
+  std::vector<char>   filled;
+  size_t              num_cells_cached = 0;
+
+public:
+  /**Assigns storage. cell_num_nodes is indexed by cell local id.*/
+  void Initialize(const std::vector<int>& cell_num_nodes,
+                  size_t in_num_angles,
+                  size_t in_num_groups,
+                  double max_megabytes)
+  {
+    num_angles = in_num_angles;
+    num_groups = in_num_groups;
+
+    const size_t num_cells   = cell_num_nodes.size();
+    const size_t budget      = static_cast<size_t>(max_megabytes*1024*1024);
+    const size_t max_doubles = budget/sizeof(double);
+
+    cell_offset.assign(num_cells, NOT_CACHED);
+    cell_entry_size.assign(num_cells, 0);
+    cell_flag_offset.assign(num_cells, 0);
+
+    size_t total = 0;
+    size_t num_flags = 0;
+    num_cells_cached = 0;
+    for (size_t c=0; c<num_cells; ++c)
+    {
+      size_t entry_size = cell_num_nodes[c]*cell_num_nodes[c];
+      size_t block_size = entry_size*num_angles*num_groups;
+      if (total + block_size > max_doubles) break;
+
+      cell_offset[c]      = total;
+      cell_entry_size[c]  = entry_size;
+      cell_flag_offset[c] = num_flags;
+
+      total     += block_size;
+      num_flags += num_angles*num_groups;
+      ++num_cells_cached;
+    }
+
+    storage.assign(total, 0.0);
+    filled.assign(num_flags, 0);
+  }
+
+  /**Returns the storage of an entry or nullptr if the cell is not
+   * cached.*/
+  double* Entry(int cell_local_id, int angle_num, int g=0)
+  {
+    size_t offset = cell_offset[cell_local_id];
+    if (offset == NOT_CACHED) return nullptr;
+
+    return &storage[offset + cell_entry_size[cell_local_id]*
+                             (angle_num*num_groups + g)];
+  }
+
+  /**Returns true if the entry has been computed.*/
+  bool IsFilled(int cell_local_id, int angle_num, int g=0) const
+  {
+    if (cell_offset[cell_local_id] == NOT_CACHED) return false;
+    return filled[cell_flag_offset[cell_local_id] +
+                  angle_num*num_groups + g] != 0;
+  }
+
+  /**Marks an entry as computed.*/
+  void SetFilled(int cell_local_id, int angle_num, int g=0)
+  {
+    filled[cell_flag_offset[cell_local_id] + angle_num*num_groups + g] = 1;
+  }
+
+  size_t NumCellsCached() const {return num_cells_cached;}
+  size_t NumCells() const {return cell_offset.size();}
+  size_t NumBytes() const
+  {return storage.size()*sizeof(double) + filled.size();}
+};
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef LBS_CELLSOLVE_KERNELS_H
+#define LBS_CELLSOLVE_KERNELS_H
+
+#include "ChiMath/chi_math.h"
+
+//###################################################################
+/**Cell solve kernels for the sweep. For each group the system
+ * \f$ (A + \sigma_t M) \psi = b + M q \f$ is assembled and solved.
+ * The node counts 2 (slab), 3 (triangle), 4 (quadrilateral/tetrahedron)
+ * and 8 (hexahedron) use fixed size, stack allocated row-major matrices.
+ * All other cells use the generic chi_math::GaussElimination.
+ *
+ * The fixed size elimination performs exactly the same operations, in
+ * the same order, as chi_math::GaussElimination so that all kernels give
+ * identical results (barring differing fused multiply-add contraction).*/
+namespace LinearBoltzmann::CellSolve
+{
+  //###################################################################
+  /**Gaussian elimination, without pivoting, of a fixed size
+   * row-major system. The solution is returned in b.*/
+  template<int N>
+  inline void GaussElimination(double* A, double* b)
+  {
+    // Forward elimination
+    for (int i = 0; i < N-1; ++i)
+    {
+      const double* ai = &A[i*N];
+      double bi = b[i];
+      double factor = 1.0/ai[i];
+      for (int j = i+1; j < N; ++j)
+      {
+        double* aj = &A[j*N];
+        double val = aj[i] * factor;
+        b[j] -= val * bi;
+        for (int k = i+1; k < N; ++k)
+          aj[k] -= val * ai[k];
+      }
+    }
+
+    // Back substitution
+    for (int i = N-1; i >= 0; --i)
+    {
+      const double* ai = &A[i*N];
+      double bi = b[i];
+      for (int j = i+1; j < N; ++j)
+        bi -= ai[j] * b[j];
+      b[i] = bi/ai[i];
+    }
+  }
+
+  //###################################################################
+  /**Assembles and solves a cell system with N nodes on the stack.*/
+  template<int N>
+  inline void AssembleAndSolve(const MatDbl& Amat,
+                               const MatDbl& M,
+                               double sigma_t,
+                               const VecDbl& source,
+                               VecDbl& b)
+  {
+    double A[N*N];
+    double x[N];
+
+    for (int i = 0; i < N; ++i)
+    {
+      const auto& Amat_i = Amat[i];
+      const auto& M_i    = M[i];
+      double temp = 0.0;
+      for (int j = 0; j < N; ++j)
+      {
+        double Mij = M_i[j];
+        A[i*N+j] = Amat_i[j] + Mij*sigma_t;
+        temp += Mij*source[j];
+      }
+      x[i] = b[i] + temp;
+    }
+
+    GaussElimination<N>(A, x);
+
+    for (int i = 0; i < N; ++i)
+      b[i] = x[i];
+  }
+
+  //###################################################################
+  /**Assembles and solves a cell system of arbitrary size using the
+   * supplied work matrix Atemp.*/
+  inline void AssembleAndSolveGeneric(const MatDbl& Amat,
+                                      const MatDbl& M,
+                                      double sigma_t,
+                                      const VecDbl& source,
+                                      MatDbl& Atemp,
+                                      VecDbl& b,
+                                      int num_nodes)
+  {
+    for (int i = 0; i < num_nodes; ++i)
+    {
+      double temp = 0.0;
+      for (int j = 0; j < num_nodes; ++j)
+      {
+        double Mij = M[i][j];
+        Atemp[i][j] = Amat[i][j] + Mij*sigma_t;
+        temp += Mij*source[j];
+      }
+      b[i] += temp;
+    }
+
+    chi_math::GaussElimination(Atemp, b, num_nodes);
+  }
+
+  //###################################################################
+  /**Performs the forward elimination of chi_math::GaussElimination on a
+   * row-major matrix without a right-hand side. The multipliers are
+   * stored in the eliminated lower triangle.*/
+  inline void FactorLU(double* A, int n)
+  {
+    for (int i = 0; i < n-1; ++i)
+    {
+      const double* ai = &A[i*n];
+      double factor = 1.0/ai[i];
+      for (int j = i+1; j < n; ++j)
+      {
+        double* aj = &A[j*n];
+        double val = aj[i] * factor;
+        aj[i] = val;
+        for (int k = i+1; k < n; ++k)
+          aj[k] -= val * ai[k];
+      }
+    }
+  }
+
+  //###################################################################
+  /**Solves a system factored with FactorLU. The operations on b are
+   * identical to those of chi_math::GaussElimination.*/
+  inline void SolveLU(const double* LU, double* b, int n)
+  {
+    // Forward elimination
+    for (int i = 0; i < n-1; ++i)
+    {
+      double bi = b[i];
+      for (int j = i+1; j < n; ++j)
+        b[j] -= LU[j*n+i] * bi;
+    }
+
+    // Back substitution
+    for (int i = n-1; i >= 0; --i)
+    {
+      const double* ai = &LU[i*n];
+      double bi = b[i];
+      for (int j = i+1; j < n; ++j)
+        bi -= ai[j] * b[j];
+      b[i] = bi/ai[i];
+    }
+  }
+
+  //###################################################################
+  /**Dispatches to the fixed size kernel matching the number of nodes,
+   * or to the generic kernel.*/
+  inline void AssembleAndSolve(const MatDbl& Amat,
+                               const MatDbl& M,
+                               double sigma_t,
+                               const VecDbl& source,
+                               MatDbl& Atemp,
+                               VecDbl& b,
+                               int num_nodes)
+  {
+    switch (num_nodes)
+    {
+      case 2: AssembleAndSolve<2>(Amat, M, sigma_t, source, b); break;
+      case 3: AssembleAndSolve<3>(Amat, M, sigma_t, source, b); break;
+      case 4: AssembleAndSolve<4>(Amat, M, sigma_t, source, b); break;
+      case 8: AssembleAndSolve<8>(Amat, M, sigma_t, source, b); break;
+      default:
+        AssembleAndSolveGeneric(Amat, M, sigma_t, source, Atemp, b, num_nodes);
+    }
+  }
+}
+
+#endif
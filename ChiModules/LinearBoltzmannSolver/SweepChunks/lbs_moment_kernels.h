@@ -0,0 +1,91 @@
+#ifndef LBS_MOMENT_KERNELS_H
+#define LBS_MOMENT_KERNELS_H
+
+#include "ChiModules/LinearBoltzmannSolver/lbs_structs.h"
+
+//###################################################################
+/**Batched moment-to-discrete and discrete-to-moment kernels for the
+ * sweep. The moments of a cell, for all the groups of a group subset,
+ * are gathered once into a contiguous block
+ * block[m*len + i*Gs + gsg], with len = num_nodes*Gs. The per-angle
+ * operations then reduce to small dense products over this block with
+ * unit-stride inner loops.
+ *
+ * The summation order of every entry is the same as the per-DOF loops
+ * it replaces, hence results are unchanged.*/
+namespace LinearBoltzmann::MomentKernels
+{
+  //###################################################################
+  /**Copies the moments of a cell, for the groups [gs_gi,gs_gi+Gs),
+   * from a flux-moment vector into a contiguous block.*/
+  inline void Gather(const std::vector<double>& phi,
+                     const LinearBoltzmann::CellLBSView& transport_view,
+                     int num_nodes, int num_moms, int gs_gi, int Gs,
+                     double* block)
+  {
+    const int len = num_nodes*Gs;
+    for (int m = 0; m < num_moms; ++m)
+      for (int i = 0; i < num_nodes; ++i)
+      {
+        const double* phi_im = &phi[transport_view.MapDOF(i, m, gs_gi)];
+        double* block_im = &block[m*len + i*Gs];
+        for (int gsg = 0; gsg < Gs; ++gsg)
+          block_im[gsg] = phi_im[gsg];
+      }
+  }
+
+  //###################################################################
+  /**Copies a block of moments back into a flux-moment vector.*/
+  inline void Scatter(const double* block,
+                      const LinearBoltzmann::CellLBSView& transport_view,
+                      int num_nodes, int num_moms, int gs_gi, int Gs,
+                      std::vector<double>& phi)
+  {
+    const int len = num_nodes*Gs;
+    for (int m = 0; m < num_moms; ++m)
+      for (int i = 0; i < num_nodes; ++i)
+      {
+        double* phi_im = &phi[transport_view.MapDOF(i, m, gs_gi)];
+        const double* block_im = &block[m*len + i*Gs];
+        for (int gsg = 0; gsg < Gs; ++gsg)
+          phi_im[gsg] = block_im[gsg];
+      }
+  }
+
+  //###################################################################
+  /**Computes the discrete source of one angle,
+   * \f$ q_k = \sum_m w_m Q_{m,k} \f$, where w holds the moment-to-discrete
+   * weights of the angle.*/
+  inline void MomentsToDiscrete(const double* block, const double* w,
+                                int num_moms, int len, double* q)
+  {
+    for (int k = 0; k < len; ++k)
+      q[k] = 0.0;
+
+    for (int m = 0; m < num_moms; ++m)
+    {
+      const double wm = w[m];
+      const double* block_m = &block[m*len];
+      for (int k = 0; k < len; ++k)
+        q[k] += wm*block_m[k];
+    }
+  }
+
+  //###################################################################
+  /**Adds the contribution of one angle to the moments,
+   * \f$ \phi_{m,k} \mathrel{+}= w_m \psi_k \f$, where w holds the
+   * discrete-to-moment weights of the angle.*/
+  inline void DiscreteToMoments(const double* psi, const double* w,
+                                int num_moms, int len, double* block)
+  {
+    for (int m = 0; m < num_moms; ++m)
+    {
+      const double wm = w[m];
+      double* block_m = &block[m*len];
+      for (int k = 0; k < len; ++k)
+        block_m[k] += wm*psi[k];
+    }
+  }
+}
+
+#endif
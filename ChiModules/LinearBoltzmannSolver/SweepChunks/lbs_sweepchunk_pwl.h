@@ -18,8 +18,15 @@
 #include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
 #include "ChiMesh/SweepUtilities/AngleAggregation/angleaggregation.h"
 
+#include "ChiModules/LinearBoltzmannSolver/Tools/lbs_threadpool.h"
+#include "lbs_cellsolve_kernels.h"
+#include "lbs_cellmatrix_cache.h"
+#include "lbs_moment_kernels.h"
+
 #include "ChiTimer/chi_timer.h"
 
+#include <iomanip>
+
 #include "chi_mpi.h"
 #include "chi_log.h"
 
@@ -35,6 +42,7 @@ class LBSSweepChunkPWL : public chi_mesh::sweep_management::SweepChunk
 {
 protected:
   const std::shared_ptr<chi_mesh::MeshContinuum> grid_view;
+  const chi_mesh::PackedMeshView& mesh_view;
   SpatialDiscretization_PWLD& grid_fe_view;
   const std::vector<LinearBoltzmann::CellLBSView>& grid_transport_view;
   const std::vector<double>* q_moments;
@@ -44,12 +52,44 @@ protected:
   const int G;
   const int max_num_cell_dofs;
 
+  /**Work space for a single cell solve. Each sweep thread owns one.*/
+  struct CellScratch
+  {
+    std::vector<std::vector<double>> Amat;
+    std::vector<std::vector<double>> Atemp;
+    std::vector<std::vector<double>> b;
+    std::vector<double> source;
+
+    //Moment blocks of the current cell, [moment x dof*group]
+    std::vector<double> q_block;   ///< Source moments
+    std::vector<double> phi_block; ///< Flux moments
+    //Discrete blocks of the current angle, [dof*group]
+    std::vector<double> src_block; ///< Angular source
+    std::vector<double> psi_block; ///< Angular flux
+    std::vector<double> m2d_w;     ///< Moment-to-discrete weights
+    std::vector<double> d2m_w;     ///< Discrete-to-moment weights
+
+    //Group-contiguous work space of group batched solves
+    std::vector<double> A_lanes;
+    std::vector<double> b_lanes;
+    std::vector<double> tmp_lanes;
+
+    //Cell matrix cache statistics
+    size_t cache_lookups = 0;
+    size_t cache_hits = 0;
+  };
+
   //Runtime params
   bool a_and_b_initialized;
-  std::vector<std::vector<double>> Amat;
-  std::vector<std::vector<double>> Atemp;
-  std::vector<std::vector<double>> b;
-  std::vector<double> source;
+  std::vector<CellScratch> scratch;
+  std::unique_ptr<LinearBoltzmann::ThreadPool> thread_pool;
+  std::vector<std::pair<int,int>> cell_nl_face_counters;
+
+  //Cell matrix caches. Only one of them is active.
+  LinearBoltzmann::CellMatrixCache amat_cache; ///< Streaming matrices
+  LinearBoltzmann::CellMatrixCache lu_cache;   ///< Factored cell systems
+  bool use_amat_cache = false;
+  bool use_lu_cache = false;
 
 public:
   // ################################################## Constructor
@@ -64,6 +104,7 @@ public:
                    const int in_max_num_cell_dofs)
     : SweepChunk(destination_phi, false),
       grid_view(std::move(grid_ptr)),
+      mesh_view(grid_view->GetPackedView()),
       grid_fe_view(discretization),
       grid_transport_view(cell_transport_views),
       q_moments(source_moments),
@@ -76,17 +117,200 @@ public:
   {}
 
   // ############################################################ Actual chunk
+  /**Sweeps all local cells of the angle set. If the groupset requests
+   * more than one sweep thread then the cells of each sweep level are
+   * distributed over a thread pool. Every cell writes only its own
+   * flux moments and face fluxes, therefore the result is identical to
+   * the serial sweep. Moment callbacks are not required to be
+   * thread-safe and their presence forces a serial sweep.*/
   void Sweep(chi_mesh::sweep_management::AngleSet* angle_set) override
   {
     if (!a_and_b_initialized)
     {
-      Amat.resize(max_num_cell_dofs, std::vector<double>(max_num_cell_dofs));
-      Atemp.resize(max_num_cell_dofs, std::vector<double>(max_num_cell_dofs));
-      b.resize(G, std::vector<double>(max_num_cell_dofs, 0.0));
-      source.resize(max_num_cell_dofs, 0.0);
+      size_t num_threads = std::max(1, groupset.sweep_num_threads);
+      scratch.resize(num_threads);
+      for (auto& ws : scratch)
+      {
+        ws.Amat.resize(max_num_cell_dofs, std::vector<double>(max_num_cell_dofs));
+        ws.Atemp.resize(max_num_cell_dofs, std::vector<double>(max_num_cell_dofs));
+        ws.b.resize(G, std::vector<double>(max_num_cell_dofs, 0.0));
+        ws.source.resize(max_num_cell_dofs, 0.0);
+        ws.q_block.resize(num_moms*max_num_cell_dofs*G, 0.0);
+        ws.phi_block.resize(num_moms*max_num_cell_dofs*G, 0.0);
+        ws.src_block.resize(max_num_cell_dofs*G, 0.0);
+        ws.psi_block.resize(max_num_cell_dofs*G, 0.0);
+        ws.m2d_w.resize(num_moms, 0.0);
+        ws.d2m_w.resize(num_moms, 0.0);
+      }
+      if (num_threads > 1)
+        thread_pool.reset(new LinearBoltzmann::ThreadPool(num_threads));
+      if (groupset.sweep_cache_max_mb > 0.0)
+        InitializeCellMatrixCache();
       a_and_b_initialized = true;
     }
 
+    auto spds = angle_set->GetSPDS();
+    size_t num_loc_cells = spds->spls.item_id.size();
+
+    bool threaded = (thread_pool != nullptr) and
+                    (not spds->spls.levels.empty()) and
+                    groupset.moment_callbacks.empty();
+
+    // ========================================================== Serial sweep
+    if (not threaded)
+    {
+      int deploc_face_counter = -1;
+      int preloc_face_counter = -1;
+
+      for (int cr_i = 0; cr_i < num_loc_cells; ++cr_i)
+        SweepCell(angle_set, cr_i,
+                  deploc_face_counter, preloc_face_counter, scratch[0]);
+      return;
+    }
+
+    // ========================================================== Threaded sweep
+    ComputeNonLocalFaceCounters(angle_set);
+
+    int level_begin = 0;
+    for (int level_end : spds->spls.levels)
+    {
+      thread_pool->ParallelFor(level_end - level_begin,
+        [this,angle_set,level_begin](size_t i, size_t thread_id)
+        {
+          int cr_i = level_begin + static_cast<int>(i);
+          int deploc_face_counter = cell_nl_face_counters[cr_i].first;
+          int preloc_face_counter = cell_nl_face_counters[cr_i].second;
+
+          SweepCell(angle_set, cr_i,
+                    deploc_face_counter, preloc_face_counter,
+                    scratch[thread_id]);
+        });
+      level_begin = level_end;
+    }
+  }//Sweep
+
+  // ################################################## Cache report
+  /**Logs the memory footprint and hit rate of the cell matrix cache,
+   * summed over all locations.*/
+  void LogCellMatrixCacheStatistics() const
+  {
+    if (not (use_amat_cache or use_lu_cache)) return;
+
+    const auto& cache = (use_lu_cache)? lu_cache : amat_cache;
+
+    unsigned long long local_vals[4] = {cache.NumCells(),
+                                        cache.NumCellsCached(),
+                                        cache.NumBytes(), 0};
+    unsigned long long lookups = 0, hits = 0;
+    for (const auto& ws : scratch)
+    {
+      lookups += ws.cache_lookups;
+      hits    += ws.cache_hits;
+    }
+    local_vals[3] = lookups;
+    unsigned long long global_vals[4];
+    MPI_Allreduce(local_vals, global_vals, 4,
+                  MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    unsigned long long global_hits;
+    MPI_Allreduce(&hits, &global_hits, 1,
+                  MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    double hit_rate = (global_vals[3] > 0)?
+      100.0*global_hits/global_vals[3] : 0.0;
+
+    chi_log.Log(LOG_0)
+      << "Cell matrix cache ("
+      << ((use_lu_cache)? "LU factors" : "streaming matrices") << "): "
+      << global_vals[1] << "/" << global_vals[0] << " cells cached, "
+      << std::setprecision(3) << global_vals[2]/1024.0/1024.0 << " MB, "
+      << "hit rate " << std::setprecision(4) << hit_rate << "%";
+  }
+
+protected:
+  // ################################################## Cache initialization
+  /**Allocates the cell matrix cache within the groupset's memory budget.
+   * When every group subset has a single group the factored cell systems
+   * are stored, otherwise the assembled streaming matrices.*/
+  void InitializeCellMatrixCache()
+  {
+    std::vector<int> cell_num_nodes;
+    cell_num_nodes.reserve(grid_view->local_cells.size());
+    for (const auto& cell : grid_view->local_cells)
+      cell_num_nodes.push_back(grid_fe_view.GetUnitIntegrals(cell).NumNodes());
+
+    size_t num_angles = groupset.quadrature->omegas.size();
+
+    bool single_group_subsets =
+      groupset.sweep_chunk_type == LinearBoltzmann::SweepChunkType::PWLD;
+    for (int gs_ss_size : groupset.grp_subset_sizes)
+      if (gs_ss_size != 1) single_group_subsets = false;
+
+    if (single_group_subsets)
+    {
+      lu_cache.Initialize(cell_num_nodes, num_angles, G,
+                          groupset.sweep_cache_max_mb);
+      use_lu_cache = true;
+    }
+    else
+    {
+      amat_cache.Initialize(cell_num_nodes, num_angles, 1,
+                            groupset.sweep_cache_max_mb);
+      use_amat_cache = true;
+    }
+  }
+
+  // ################################################## Non-local counters
+  /**The non-local face counters are running counters over the sweep
+   * ordering. For a threaded sweep their value at the start of each
+   * cell is computed beforehand. As in the serial sweep, the counters
+   * are carried over from the last angle of the angle set.*/
+  void ComputeNonLocalFaceCounters(chi_mesh::sweep_management::AngleSet* angle_set)
+  {
+    auto spds = angle_set->GetSPDS();
+    size_t num_loc_cells = spds->spls.item_id.size();
+
+    const chi_mesh::Vector3& omega =
+      groupset.quadrature->omegas[angle_set->angles.back()];
+
+    cell_nl_face_counters.resize(num_loc_cells);
+
+    int deploc_face_counter = -1;
+    int preloc_face_counter = -1;
+    for (int cr_i = 0; cr_i < num_loc_cells; ++cr_i)
+    {
+      cell_nl_face_counters[cr_i] = {deploc_face_counter, preloc_face_counter};
+
+      int cell_local_id = spds->spls.item_id[cr_i];
+      auto& transport_view = grid_transport_view[cell_local_id];
+      const uint64_t face_base = mesh_view.FaceIndex(cell_local_id, 0);
+      const int num_faces = mesh_view.NumCellFaces(cell_local_id);
+
+      for (int f = 0; f < num_faces; ++f)
+      {
+        const uint64_t fidx = face_base + f;
+        if (transport_view.face_local[f] or
+            (not mesh_view.face_has_neighbor[fidx])) continue;
+
+        if (omega.Dot(mesh_view.face_normals[fidx]) < 0.0) ++preloc_face_counter;
+        else                                               ++deploc_face_counter;
+      }
+    }
+  }
+
+  // ################################################## Cell solve
+  /**Solves a single cell, in sweep ordering position cr_i, for all
+   * angles of the angle set and all groups of its group subset. Face
+   * normals, neighbors and vertex counts are read from the grid's packed
+   * view instead of the cell objects.*/
+  void SweepCell(chi_mesh::sweep_management::AngleSet* angle_set,
+                 int cr_i,
+                 int& deploc_face_counter,
+                 int& preloc_face_counter,
+                 CellScratch& ws)
+  {
+    auto& Amat   = ws.Amat;
+    auto& b      = ws.b;
+
     auto spds = angle_set->GetSPDS();
     auto fluds = angle_set->fluds;
 
@@ -95,235 +319,319 @@ public:
     int gs_ss_begin = subset.first;
     int gs_gi = groupset.groups[gs_ss_begin].id; // Groupset subset first group number
 
-    int deploc_face_counter = -1;
-    int preloc_face_counter = -1;
-
     auto const& d2m_op = groupset.quadrature->GetDiscreteToMomentOperator();
     auto const& m2d_op = groupset.quadrature->GetMomentToDiscreteOperator();
 
-    // ========================================================== Loop over each cell
-    size_t num_loc_cells = spds->spls.item_id.size();
-    for (int cr_i = 0; cr_i < num_loc_cells; ++cr_i)
+    int cell_local_id = spds->spls.item_id[cr_i];
+    const auto& cell = grid_view->local_cells[cell_local_id];
+    const auto& fe_intgrl_values = grid_fe_view.GetUnitIntegrals(cell);
+    int num_faces = mesh_view.NumCellFaces(cell_local_id);
+    const uint64_t face_base = mesh_view.FaceIndex(cell_local_id, 0);
+    int num_dofs = fe_intgrl_values.NumNodes();
+    auto& transport_view = grid_transport_view[cell.local_id];
+    const auto& sigma_tg = xsections[transport_view.xs_id]->sigma_tg;
+    std::vector<bool> face_incident_flags(num_faces, false);
+
+    // =================================================== Get Cell matrices
+    const std::vector<std::vector<chi_mesh::Vector3>>& L =
+      fe_intgrl_values.GetIntV_shapeI_gradshapeJ();
+
+    const std::vector<std::vector<double>>& M =
+      fe_intgrl_values.GetIntV_shapeI_shapeJ();
+
+    const std::vector<std::vector<std::vector<double>>>& N =
+      fe_intgrl_values.GetIntS_shapeI_shapeJ();
+
+    // =================================================== Gather moments
+    const int block_len = num_dofs*gs_ss_size;
+    LinearBoltzmann::MomentKernels::
+      Gather(*q_moments, transport_view, num_dofs, num_moms,
+             gs_gi, gs_ss_size, ws.q_block.data());
+    LinearBoltzmann::MomentKernels::
+      Gather(*x, transport_view, num_dofs, num_moms,
+             gs_gi, gs_ss_size, ws.phi_block.data());
+
+    // =================================================== Loop over angles in set
+    int ni_deploc_face_counter = deploc_face_counter;
+    int ni_preloc_face_counter = preloc_face_counter;
+    for (int n = 0; n < angle_set->angles.size(); ++n)
     {
-      int cell_local_id = spds->spls.item_id[cr_i];
-      const auto& cell = grid_view->local_cells[cell_local_id];
-      const auto& fe_intgrl_values = grid_fe_view.GetUnitIntegrals(cell);
-      int num_faces = cell.faces.size();
-      int num_dofs = fe_intgrl_values.NumNodes();
-      auto& transport_view = grid_transport_view[cell.local_id];
-      auto sigma_tg = xsections[transport_view.xs_id]->sigma_tg;
-      std::vector<bool> face_incident_flags(num_faces, false);
-
-      // =================================================== Get Cell matrices
-      const std::vector<std::vector<chi_mesh::Vector3>>& L =
-        fe_intgrl_values.GetIntV_shapeI_gradshapeJ();
-
-      const std::vector<std::vector<double>>& M =
-        fe_intgrl_values.GetIntV_shapeI_shapeJ();
-
-      const std::vector<std::vector<std::vector<double>>>& N =
-        fe_intgrl_values.GetIntS_shapeI_shapeJ();
-
-      // =================================================== Loop over angles in set
-      int ni_deploc_face_counter = deploc_face_counter;
-      int ni_preloc_face_counter = preloc_face_counter;
-      for (int n = 0; n < angle_set->angles.size(); ++n)
-      {
-        deploc_face_counter = ni_deploc_face_counter;
-        preloc_face_counter = ni_preloc_face_counter;
-        int angle_num = angle_set->angles[n];
-        chi_mesh::Vector3 omega = groupset.quadrature->omegas[angle_num];
+      deploc_face_counter = ni_deploc_face_counter;
+      preloc_face_counter = ni_preloc_face_counter;
+      int angle_num = angle_set->angles[n];
+      chi_mesh::Vector3 omega = groupset.quadrature->omegas[angle_num];
 
-        // ============================================ Gradient matrix
+      // ============================================ Angular source
+      for (int m = 0; m < num_moms; ++m)
+      {
+        ws.m2d_w[m] = m2d_op[m][angle_num];
+        ws.d2m_w[m] = d2m_op[m][angle_num];
+      }
+      LinearBoltzmann::MomentKernels::
+        MomentsToDiscrete(ws.q_block.data(), ws.m2d_w.data(),
+                          num_moms, block_len, ws.src_block.data());
+
+      // ============================================ Cached matrices
+      double* amat_entry = nullptr;
+      bool amat_cached = false;
+      bool lu_cached = false;
+      if (use_amat_cache)
+      {
+        amat_entry  = amat_cache.Entry(cell.local_id, angle_num);
+        amat_cached = amat_cache.IsFilled(cell.local_id, angle_num);
+        ++ws.cache_lookups;
+        if (amat_cached) ++ws.cache_hits;
+      }
+      else if (use_lu_cache)
+        lu_cached = lu_cache.IsFilled(cell.local_id, angle_num, gs_ss_begin);
+      bool assemble_amat = not (amat_cached or lu_cached);
+
+      // ============================================ Gradient matrix
+      if (amat_cached)
+      {
+        for (int i = 0; i < num_dofs; ++i)
+          for (int j = 0; j < num_dofs; ++j)
+            Amat[i][j] = amat_entry[i*num_dofs + j];
+      }
+      else if (assemble_amat)
+      {
         for (int i = 0; i < num_dofs; ++i)
           for (int j = 0; j < num_dofs; ++j)
             Amat[i][j] = omega.Dot(L[i][j]);
+      }
 
-        for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-          b[gsg].assign(num_dofs, 0.0);
+      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+        b[gsg].assign(num_dofs, 0.0);
+
+      // ============================================ Surface integrals
+      int in_face_counter = -1;
+      for (int f = 0; f < num_faces; ++f)
+      {
+        const uint64_t fidx = face_base + f;
+        double mu = omega.Dot(mesh_view.face_normals[fidx]);
 
-        // ============================================ Surface integrals
-        int in_face_counter = -1;
-        for (int f = 0; f < num_faces; ++f)
+        if (mu < 0.0) // Upwind
         {
-          auto& face = cell.faces[f];
-          double mu = omega.Dot(face.normal);
+          face_incident_flags[f] = true;
+          bool local = transport_view.face_local[f];
+          bool boundary = not mesh_view.face_has_neighbor[fidx];
+          int num_face_indices = mesh_view.NumFaceVertices(fidx);
 
-          if (mu < 0.0) // Upwind
+          if (local)
           {
-            face_incident_flags[f] = true;
-            bool local = transport_view.face_local[f];
-            bool boundary = not face.has_neighbor;
-            int num_face_indices = face.vertex_ids.size();
-
-            if (local)
+            in_face_counter++;
+            for (int fi = 0; fi < num_face_indices; ++fi)
             {
-              in_face_counter++;
-              for (int fi = 0; fi < num_face_indices; ++fi)
+              int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              for (int fj = 0; fj < num_face_indices; ++fj)
               {
-                int i = fe_intgrl_values.FaceDofMapping(f,fi);
-                for (int fj = 0; fj < num_face_indices; ++fj)
-                {
-                  int j = fe_intgrl_values.FaceDofMapping(f,fj);
-                  double *psi = fluds->UpwindPsi(cr_i,in_face_counter,fj,0,n);
-                  double mu_Nij = -mu*N[f][i][j];
-                  Amat[i][j] += mu_Nij;
-                  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-                    b[gsg][i] += psi[gsg]*mu_Nij;
-                }
+                int j = fe_intgrl_values.FaceDofMapping(f,fj);
+                double *psi = fluds->UpwindPsi(cr_i,in_face_counter,fj,0,n);
+                double mu_Nij = -mu*N[f][i][j];
+                if (assemble_amat) Amat[i][j] += mu_Nij;
+                for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                  b[gsg][i] += psi[gsg]*mu_Nij;
               }
             }
-            else if (not boundary)
+          }
+          else if (not boundary)
+          {
+            preloc_face_counter++;
+            for (int fi = 0; fi < num_face_indices; ++fi)
             {
-              preloc_face_counter++;
-              for (int fi = 0; fi < num_face_indices; ++fi)
+              int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              for (int fj = 0; fj < num_face_indices; ++fj)
               {
-                int i = fe_intgrl_values.FaceDofMapping(f,fi);
-                for (int fj = 0; fj < num_face_indices; ++fj)
-                {
-                  int j = fe_intgrl_values.FaceDofMapping(f,fj);
-                  double *psi = fluds->NLUpwindPsi(preloc_face_counter,fj,0,n);
-                  double mu_Nij = -mu*N[f][i][j];
-                  Amat[i][j] += mu_Nij;
-                  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-                    b[gsg][i] += psi[gsg]*mu_Nij;
-                }
+                int j = fe_intgrl_values.FaceDofMapping(f,fj);
+                double *psi = fluds->NLUpwindPsi(preloc_face_counter,fj,0,n);
+                double mu_Nij = -mu*N[f][i][j];
+                if (assemble_amat) Amat[i][j] += mu_Nij;
+                for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                  b[gsg][i] += psi[gsg]*mu_Nij;
               }
             }
-            else
+          }
+          else
+          {
+            // This counter update-logic is for mapping an incident boundary
+            // condition. Because it is cheap, the cell faces was mapped to a
+            // corresponding boundary during initialization and is
+            // independent of angle. Accessing things like reflective boundary
+            // angular fluxes (and complex boundary conditions), requires the
+            // more general bndry_face_counter.
+            int bndry_index = mesh_view.face_neighbor_ids[fidx];
+            for (int fi = 0; fi < num_face_indices; ++fi)
             {
-              // This counter update-logic is for mapping an incident boundary
-              // condition. Because it is cheap, the cell faces was mapped to a
-              // corresponding boundary during initialization and is
-              // independent of angle. Accessing things like reflective boundary
-              // angular fluxes (and complex boundary conditions), requires the
-              // more general bndry_face_counter.
-              int bndry_index = face.neighbor_id;
-              for (int fi = 0; fi < num_face_indices; ++fi)
+              int i = fe_intgrl_values.FaceDofMapping(f,fi);
+              for (int fj = 0; fj < num_face_indices; ++fj)
               {
-                int i = fe_intgrl_values.FaceDofMapping(f,fi);
-                for (int fj = 0; fj < num_face_indices; ++fj)
-                {
-                  int j = fe_intgrl_values.FaceDofMapping(f,fj);
-                  double *psi = angle_set->PsiBndry(bndry_index,
-                                                    angle_num,
-                                                    cell.local_id,
-                                                    f, fj, gs_gi, gs_ss_begin,
-                                                    suppress_surface_src);
-                  double mu_Nij = -mu*N[f][i][j];
-                  Amat[i][j] += mu_Nij;
-                  for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-                    b[gsg][i] += psi[gsg]*mu_Nij;
-                }
+                int j = fe_intgrl_values.FaceDofMapping(f,fj);
+                double *psi = angle_set->PsiBndry(bndry_index,
+                                                  angle_num,
+                                                  cell.local_id,
+                                                  f, fj, gs_gi, gs_ss_begin,
+                                                  suppress_surface_src);
+                double mu_Nij = -mu*N[f][i][j];
+                if (assemble_amat) Amat[i][j] += mu_Nij;
+                for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+                  b[gsg][i] += psi[gsg]*mu_Nij;
               }
             }
-          } // if upwind
-        } // for f
+          }
+        } // if upwind
+      } // for f
 
-        // ========================================== Looping over groups
-        for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-        {
-          int g = gs_gi+gsg;
+      if (amat_entry != nullptr and not amat_cached)
+      {
+        for (int i = 0; i < num_dofs; ++i)
+          for (int j = 0; j < num_dofs; ++j)
+            amat_entry[i*num_dofs + j] = Amat[i][j];
+        amat_cache.SetFilled(cell.local_id, angle_num);
+      }
 
-          // ============================= Contribute source moments
-          for (int i = 0; i < num_dofs; ++i)
-          {
-            double temp_src = 0.0;
-            for (int m = 0; m < num_moms; ++m)
-            {
-              int ir = transport_view.MapDOF(i, m, g);
-              temp_src += m2d_op[m][angle_num]*(*q_moments)[ir];
-            }
-            source[i] = temp_src;
-          }
+      // ========================================== Solve for all groups
+      SolveGroups(cell.local_id, transport_view, M, sigma_tg,
+                  num_dofs, angle_num, gs_ss_begin, gs_gi, gs_ss_size, ws);
 
-          // ============================= Mass Matrix and Source
-          double sigma_tgr = sigma_tg[g];
-          for (int i = 0; i < num_dofs; ++i)
-          {
-            double temp = 0.0;
-            for (int j = 0; j < num_dofs; ++j)
-            {
-              double Mij = M[i][j];
-              Atemp[i][j] = Amat[i][j] + Mij*sigma_tgr;
-              temp += Mij*source[j];
-            }
-            b[gsg][i] += temp;
-          }
+      // ============================= Accumulate flux
+      for (int i = 0; i < num_dofs; ++i)
+        for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+          ws.psi_block[i*gs_ss_size + gsg] = b[gsg][i];
 
-          // ============================= Solve system
-          chi_math::GaussElimination(Atemp, b[gsg], fe_intgrl_values.NumNodes());
-        }
+      LinearBoltzmann::MomentKernels::
+        DiscreteToMoments(ws.psi_block.data(), ws.d2m_w.data(),
+                          num_moms, block_len, ws.phi_block.data());
 
-        // ============================= Accumulate flux
+      if (not groupset.moment_callbacks.empty())
         for (int m = 0; m < num_moms; ++m)
-        {
-          double wn_d2m = d2m_op[m][angle_num];
           for (int i = 0; i < num_dofs; ++i)
           {
             int ir = transport_view.MapDOF(i, m, gs_gi);
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              (*x)[ir + gsg] += wn_d2m*b[gsg][i];
-
             for (const auto& callback : groupset.moment_callbacks)
               for (int gsg=0; gsg<gs_ss_size; gsg++)
                 callback(cell.local_id, ir+gsg, i, gsg, m, angle_num, b[gsg][i]);
           }
-        }
 
-        int out_face_counter = -1;
-        for (int f = 0; f < num_faces; ++f)
-        {
-          if (face_incident_flags[f]) continue;
+      int out_face_counter = -1;
+      for (int f = 0; f < num_faces; ++f)
+      {
+        if (face_incident_flags[f]) continue;
 
-          // ============================= Set flags and counters
-          out_face_counter++;
-          auto& face = cell.faces[f];
-          bool local = transport_view.face_local[f];
-          bool boundary = not face.has_neighbor;
-          int num_face_indices = face.vertex_ids.size();
+        // ============================= Set flags and counters
+        out_face_counter++;
+        const uint64_t fidx = face_base + f;
+        bool local = transport_view.face_local[f];
+        bool boundary = not mesh_view.face_has_neighbor[fidx];
+        int num_face_indices = mesh_view.NumFaceVertices(fidx);
 
-          if (local)
+        if (local)
+        {
+          for (int fi = 0; fi < num_face_indices; ++fi)
           {
-            for (int fi = 0; fi < num_face_indices; ++fi)
-            {
-              int i = fe_intgrl_values.FaceDofMapping(f,fi);
-              double *psi = fluds->OutgoingPsi(cr_i, out_face_counter, fi, n);
-              for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-                psi[gsg] = b[gsg][i];
-            }
+            int i = fe_intgrl_values.FaceDofMapping(f,fi);
+            double *psi = fluds->OutgoingPsi(cr_i, out_face_counter, fi, n);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              psi[gsg] = b[gsg][i];
           }
-          else if (not boundary)
+        }
+        else if (not boundary)
+        {
+          deploc_face_counter++;
+          for (int fi = 0; fi < num_face_indices; ++fi)
+          {
+            int i = fe_intgrl_values.FaceDofMapping(f,fi);
+            double *psi = fluds->NLOutgoingPsi(deploc_face_counter, fi, n);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              psi[gsg] = b[gsg][i];
+          }
+        }
+        else // Store outgoing reflecting Psi
+        {
+          int bndry_index = mesh_view.face_neighbor_ids[fidx];
+          if (angle_set->ref_boundaries[bndry_index]->IsReflecting())
           {
-            deploc_face_counter++;
             for (int fi = 0; fi < num_face_indices; ++fi)
             {
               int i = fe_intgrl_values.FaceDofMapping(f,fi);
-              double *psi = fluds->NLOutgoingPsi(deploc_face_counter, fi, n);
+              double *psi = angle_set->ReflectingPsiOutBoundBndry(bndry_index, angle_num,
+                                                                  cell.local_id, f,
+                                                                  fi, gs_ss_begin);
               for (int gsg = 0; gsg < gs_ss_size; ++gsg)
                 psi[gsg] = b[gsg][i];
             }
           }
-          else // Store outgoing reflecting Psi
+        }
+      }
+    } // for n
+
+    // =================================================== Scatter moments
+    LinearBoltzmann::MomentKernels::
+      Scatter(ws.phi_block.data(), transport_view, num_dofs, num_moms,
+              gs_gi, gs_ss_size, *x);
+  }//SweepCell
+
+  // ################################################## Group solves
+  /**Adds the angular source of each group of the subset, ws.src_block,
+   * to the upwind right-hand-sides in ws.b and solves the cell systems. The solutions
+   * are returned in ws.b. Derived chunks can override this to change
+   * how the groups are solved.*/
+  virtual void SolveGroups(int cell_local_id,
+                           const LinearBoltzmann::CellLBSView& transport_view,
+                           const std::vector<std::vector<double>>& M,
+                           const std::vector<double>& sigma_tg,
+                           int num_dofs, int angle_num,
+                           int gs_ss_begin, int gs_gi, int gs_ss_size,
+                           CellScratch& ws)
+  {
+    for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+    {
+      int g = gs_gi+gsg;
+
+      // ============================= Contribute source moments
+      for (int i = 0; i < num_dofs; ++i)
+        ws.source[i] = ws.src_block[i*gs_ss_size + gsg];
+
+      // ============================= Cached factors
+      double* lu = (use_lu_cache)?
+        lu_cache.Entry(cell_local_id, angle_num, gs_ss_begin+gsg) : nullptr;
+      if (use_lu_cache) ++ws.cache_lookups;
+      if (lu != nullptr)
+      {
+        bool lu_cached = lu_cache.IsFilled(cell_local_id, angle_num,
+                                           gs_ss_begin+gsg);
+        if (lu_cached) ++ws.cache_hits;
+
+        double sigma_tgr = sigma_tg[g];
+        auto& b_g = ws.b[gsg];
+        for (int i = 0; i < num_dofs; ++i)
+        {
+          double temp = 0.0;
+          for (int j = 0; j < num_dofs; ++j)
           {
-            int bndry_index = face.neighbor_id;
-            if (angle_set->ref_boundaries[bndry_index]->IsReflecting())
-            {
-              for (int fi = 0; fi < num_face_indices; ++fi)
-              {
-                int i = fe_intgrl_values.FaceDofMapping(f,fi);
-                double *psi = angle_set->ReflectingPsiOutBoundBndry(bndry_index, angle_num,
-                                                                    cell.local_id, f,
-                                                                    fi, gs_ss_begin);
-                for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-                  psi[gsg] = b[gsg][i];
-              }
-            }
+            double Mij = M[i][j];
+            if (not lu_cached)
+              lu[i*num_dofs + j] = ws.Amat[i][j] + Mij*sigma_tgr;
+            temp += Mij*ws.source[j];
           }
+          b_g[i] += temp;
         }
-      } // for n
-    } // for cell
-  }//Sweep
+
+        if (not lu_cached)
+        {
+          LinearBoltzmann::CellSolve::FactorLU(lu, num_dofs);
+          lu_cache.SetFilled(cell_local_id, angle_num, gs_ss_begin+gsg);
+        }
+
+        LinearBoltzmann::CellSolve::SolveLU(lu, b_g.data(), num_dofs);
+        continue;
+      }
+
+      // ============================= Mass Matrix, Source and solve
+      LinearBoltzmann::CellSolve::
+        AssembleAndSolve(ws.Amat, M, sigma_tg[g], ws.source,
+                         ws.Atemp, ws.b[gsg], num_dofs);
+    }
+  }
 };
 
 #endif
@@ -0,0 +1,132 @@
+#ifndef LBS_SWEEPCHUNK_PWL_GROUPBATCHED_H
+#define LBS_SWEEPCHUNK_PWL_GROUPBATCHED_H
+
+#include "lbs_sweepchunk_pwl.h"
+
+// ###################################################################
+/**PWLD sweep chunk that solves all the groups of a group subset together.
+ * The cell systems \f$ A + \sigma_{t,g} M \f$ differ per group only by
+ * the total cross section, hence all of them are stored group-contiguous
+ * (group index fastest) and eliminated in a single lane-parallel pass over
+ * the cell matrices. The innermost loops run over the groups and are free
+ * of dependencies, which allows the compiler to vectorize them.
+ *
+ * Each lane performs exactly the same operations, in the same order, as
+ * the per-group solve of LBSSweepChunkPWL. Results are identical unless
+ * the compiler contracts operations into fused multiply-adds
+ * differently for the two loop shapes (-ffp-contract).*/
+class LBSSweepChunkPWLGroupBatched : public LBSSweepChunkPWL
+{
+public:
+  using LBSSweepChunkPWL::LBSSweepChunkPWL;
+
+protected:
+  // ################################################## Group solves
+  void SolveGroups(int cell_local_id,
+                   const LinearBoltzmann::CellLBSView& transport_view,
+                   const std::vector<std::vector<double>>& M,
+                   const std::vector<double>& sigma_tg,
+                   int num_dofs, int angle_num,
+                   int gs_ss_begin, int gs_gi, int gs_ss_size,
+                   CellScratch& ws) override
+  {
+    const int n  = num_dofs;
+    const int Gs = gs_ss_size;
+
+    if (ws.A_lanes.size() < max_num_cell_dofs*max_num_cell_dofs*G)
+    {
+      ws.A_lanes.resize(max_num_cell_dofs*max_num_cell_dofs*G, 0.0);
+      ws.b_lanes.resize(max_num_cell_dofs*G, 0.0);
+      ws.tmp_lanes.resize(G, 0.0);
+    }
+
+    double* A   = ws.A_lanes.data();   //A[(i*n + j)*Gs + gsg]
+    double* b   = ws.b_lanes.data();   //b[i*Gs + gsg]
+    const double* src = ws.src_block.data(); //src[i*Gs + gsg]
+    double* tmp = ws.tmp_lanes.data(); //tmp[gsg]
+
+    const double* sig = &sigma_tg[gs_gi];
+
+    // ============================= Mass Matrix and Source
+    for (int i = 0; i < n; ++i)
+    {
+      for (int gsg = 0; gsg < Gs; ++gsg)
+        tmp[gsg] = 0.0;
+
+      for (int j = 0; j < n; ++j)
+      {
+        const double Aij = ws.Amat[i][j];
+        const double Mij = M[i][j];
+        double* A_ij = &A[(i*n + j)*Gs];
+        const double* src_j = &src[j*Gs];
+        for (int gsg = 0; gsg < Gs; ++gsg)
+        {
+          A_ij[gsg] = Aij + Mij*sig[gsg];
+          tmp[gsg] += Mij*src_j[gsg];
+        }
+      }
+
+      const auto& b_upw = ws.b;
+      double* b_i = &b[i*Gs];
+      for (int gsg = 0; gsg < Gs; ++gsg)
+        b_i[gsg] = b_upw[gsg][i] + tmp[gsg];
+    }
+
+    // ============================= Forward elimination
+    for (int i = 0; i < n-1; ++i)
+    {
+      const double* b_i = &b[i*Gs];
+      for (int gsg = 0; gsg < Gs; ++gsg)
+        tmp[gsg] = 1.0/A[(i*n + i)*Gs + gsg];
+
+      for (int j = i+1; j < n; ++j)
+      {
+        double* A_ji = &A[(j*n + i)*Gs];
+        double* b_j  = &b[j*Gs];
+        for (int gsg = 0; gsg < Gs; ++gsg)
+        {
+          A_ji[gsg] *= tmp[gsg]; //Multiplier stored in eliminated entry
+          b_j[gsg] -= A_ji[gsg] * b_i[gsg];
+        }
+
+        for (int k = i+1; k < n; ++k)
+        {
+          double* A_jk = &A[(j*n + k)*Gs];
+          const double* A_ik = &A[(i*n + k)*Gs];
+          for (int gsg = 0; gsg < Gs; ++gsg)
+            A_jk[gsg] -= A_ji[gsg] * A_ik[gsg];
+        }
+      }
+    }
+
+    // ============================= Back substitution
+    for (int i = n-1; i >= 0; --i)
+    {
+      double* b_i = &b[i*Gs];
+      for (int gsg = 0; gsg < Gs; ++gsg)
+        tmp[gsg] = b_i[gsg];
+
+      for (int j = i+1; j < n; ++j)
+      {
+        const double* A_ij = &A[(i*n + j)*Gs];
+        const double* b_j  = &b[j*Gs];
+        for (int gsg = 0; gsg < Gs; ++gsg)
+          tmp[gsg] -= A_ij[gsg] * b_j[gsg];
+      }
+
+      const double* A_ii = &A[(i*n + i)*Gs];
+      for (int gsg = 0; gsg < Gs; ++gsg)
+        b_i[gsg] = tmp[gsg]/A_ii[gsg];
+    }
+
+    // ============================= Return solutions
+    for (int gsg = 0; gsg < Gs; ++gsg)
+    {
+      auto& b_g = ws.b[gsg];
+      for (int i = 0; i < n; ++i)
+        b_g[i] = b[i*Gs + gsg];
+    }
+  }
+};
+
+#endif
@@ -11,6 +11,16 @@ struct KSPDataContext
   LBSGroupset*    groupset;
   KSP              krylov_solver;
   Vec              x_temp;
+  bool             x_temp_wraps_phi_new = false; ///< x_temp is phi_new_local
   chi_mesh::sweep_management::SweepScheduler* sweepScheduler;
   int last_iteration = -1;
+
+  double rhs_norm = -1.0;           ///< Cached since the rhs is fixed
+  double matvec_time = 0.0;         ///< ms in matrix actions, current iteration
+  double total_matvec_time = 0.0;   ///< ms in matrix actions
+  double total_krylov_time = 0.0;   ///< ms outside matrix actions
+  double last_iteration_time = -1.0;
+  double last_matvec_time = 0.0;
+  double last_krylov_time = 0.0;
+  int    num_timed_iterations = 0;
 };
\ No newline at end of file
@@ -11,22 +11,62 @@ extern ChiLog&     chi_log;
 extern ChiTimer   chi_program_timer;
 
 //###################################################################
-/**Customized monitor for PETSc Krylov sub-space solvers.*/
+/**Returns the norm of the rhs, computed once per solve since the rhs
+ * does not change. Saves a global reduction per Krylov iteration.*/
+static double GetRhsNorm(KSP ksp, KSPDataContext* context)
+{
+  if (context->rhs_norm < 0.0)
+  {
+    Vec Rhs;
+    KSPGetRhs(ksp,&Rhs);
+    VecNorm(Rhs,NORM_2,&context->rhs_norm);
+  }
+  return context->rhs_norm;
+}
+
+//###################################################################
+/**Customized monitor for PETSc Krylov sub-space solvers. The iteration
+ * timings are printed by KSPConvergenceTestNPT, since PETSc calls the
+ * monitor before the convergence test has timed the iteration.*/
 PetscErrorCode
 KSPMonitorNPT(KSP ksp, PetscInt n, PetscReal rnorm, void *monitordestroy)
 {
-  Vec Rhs;
-
-  KSPGetRhs(ksp,&Rhs);
+  KSPDataContext* context;
+  KSPGetApplicationContext(ksp,&context);
 
-  double rhs_norm;
-  VecNorm(Rhs,NORM_2,&rhs_norm);
+  double rhs_norm = GetRhsNorm(ksp, context);
+  if (rhs_norm < 1.0e-25)
+    rhs_norm = 1.0;
 
   chi_log.Log(LOG_0) << "Iteration " << n << " Residual " << rnorm/rhs_norm;
 
   return 0;
 }
 
+//###################################################################
+/**Splits the time since the previous iteration into time spent in
+ * matrix actions and time spent in the Krylov method itself. Returns
+ * false for the first iteration, which has nothing to time.*/
+static bool UpdateIterationTimings(KSPDataContext* context)
+{
+  double now = chi_program_timer.GetTime();
+  bool timed = (context->last_iteration_time >= 0.0);
+  if (timed)
+  {
+    double iteration_time = now - context->last_iteration_time;
+    context->last_matvec_time = context->matvec_time;
+    context->last_krylov_time = std::max(iteration_time -
+                                         context->matvec_time, 0.0);
+    context->total_matvec_time += context->last_matvec_time;
+    context->total_krylov_time += context->last_krylov_time;
+    ++context->num_timed_iterations;
+  }
+  context->last_iteration_time = now;
+  context->matvec_time = 0.0;
+
+  return timed;
+}
+
 
 
 //###################################################################
@@ -40,11 +80,10 @@ KSPConvergenceTestNPT(KSP ksp, PetscInt n, PetscReal rnorm,
   KSPDataContext* context;
   KSPGetApplicationContext(ksp,&context);
 
+  bool timed = UpdateIterationTimings(context);
+
   //======================================== Compute rhs norm
-  Vec Rhs;
-  KSPGetRhs(ksp,&Rhs);
-  double rhs_norm;
-  VecNorm(Rhs,NORM_2,&rhs_norm);
+  double rhs_norm = GetRhsNorm(ksp, context);
   if (rhs_norm < 1.0e-25)
     rhs_norm = 1.0;
 
@@ -74,6 +113,14 @@ KSPConvergenceTestNPT(KSP ksp, PetscInt n, PetscReal rnorm,
     << " Iteration " << std::setw(5) << n
     << " Residual " << std::setw(9) << relative_residual;
 
+  //The time of this iteration split into the matrix action (source and
+  //sweep) and the remaining Krylov work, which is dominated by the
+  //global reductions of the orthogonalization at scale
+  if (timed)
+    iter_info
+      << " Sweep time " << context->last_matvec_time/1000.0
+      << " s Krylov time " << context->last_krylov_time/1000.0 << " s";
+
   if (relative_residual < tol)
   {
     *convergedReason = KSP_CONVERGED_RTOL;
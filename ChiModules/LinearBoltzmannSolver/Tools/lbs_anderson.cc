@@ -0,0 +1,160 @@
+#include "lbs_anderson.h"
+
+#include <chi_mpi.h>
+
+#include <cmath>
+#include <algorithm>
+
+//###################################################################
+/**Creates an accelerator of the given depth acting on the listed
+ * entries of the local vectors.*/
+LinearBoltzmann::AndersonAccelerator::
+  AndersonAccelerator(size_t in_depth, std::vector<size_t> in_indices) :
+  depth(std::max<size_t>(in_depth,1)),
+  indices(std::move(in_indices))
+{
+  const size_t n = indices.size();
+  delta_f.assign(depth, std::vector<double>(n,0.0));
+  delta_g.assign(depth, std::vector<double>(n,0.0));
+  gram.assign(depth, std::vector<double>(depth,0.0));
+  f_prev.assign(n,0.0);
+  g_prev.assign(n,0.0);
+}
+
+//###################################################################
+/**Discards the history, e.g. when the fixed-point map changes.*/
+void LinearBoltzmann::AndersonAccelerator::Reset()
+{
+  num_stored = 0;
+  head = 0;
+  has_prev = false;
+}
+
+//###################################################################
+/**Given the current iterate x and the map value g = g(x), overwrites g
+ * with the Anderson mixed iterate. Collective.*/
+void LinearBoltzmann::AndersonAccelerator::
+  Mix(const std::vector<double>& x, std::vector<double>& g)
+{
+  const size_t n = indices.size();
+
+  //============================================= Update history
+  std::vector<double> f(n);
+  for (size_t i=0; i<n; ++i)
+    f[i] = g[indices[i]] - x[indices[i]];
+
+  size_t s = head;
+  if (has_prev)
+  {
+    auto& df = delta_f[s];
+    auto& dg = delta_g[s];
+    for (size_t i=0; i<n; ++i)
+    {
+      df[i] = f[i] - f_prev[i];
+      dg[i] = g[indices[i]] - g_prev[i];
+    }
+    num_stored = std::min(num_stored+1, depth);
+    head = (head+1)%depth;
+  }
+
+  for (size_t i=0; i<n; ++i)
+  {
+    f_prev[i] = f[i];
+    g_prev[i] = g[indices[i]];
+  }
+
+  bool had_prev = has_prev;
+  has_prev = true;
+  if (not had_prev) return;
+
+  //============================================= Fused reductions
+  // [0,m): new Gram row, [m,2m): dF^T f
+  const size_t m = num_stored;
+  std::vector<double> local_dots(2*m,0.0);
+  for (size_t j=0; j<m; ++j)
+  {
+    const auto& dfs = delta_f[s];
+    const auto& dfj = delta_f[j];
+    double gram_sj = 0.0;
+    double rhs_j   = 0.0;
+    for (size_t i=0; i<n; ++i)
+    {
+      gram_sj += dfs[i]*dfj[i];
+      rhs_j   += dfj[i]*f[i];
+    }
+    local_dots[j]   = gram_sj;
+    local_dots[m+j] = rhs_j;
+  }
+
+  std::vector<double> dots(2*m,0.0);
+  MPI_Allreduce(local_dots.data(), dots.data(), static_cast<int>(2*m),
+                MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  for (size_t j=0; j<m; ++j)
+  {
+    gram[s][j] = dots[j];
+    gram[j][s] = dots[j];
+  }
+
+  //============================================= Solve least squares
+  std::vector<std::vector<double>> A(m, std::vector<double>(m,0.0));
+  std::vector<double> gamma(dots.begin()+m, dots.end());
+  double max_diag = 0.0;
+  for (size_t j=0; j<m; ++j)
+    max_diag = std::max(max_diag, gram[j][j]);
+  for (size_t j=0; j<m; ++j)
+  {
+    for (size_t k=0; k<m; ++k)
+      A[j][k] = gram[j][k];
+    A[j][j] += 1.0e-12*max_diag;
+  }
+
+  if (max_diag <= 0.0 or not SolveDense(A, gamma))
+  {
+    Reset();
+    return;
+  }
+
+  //============================================= Mix
+  for (size_t j=0; j<m; ++j)
+  {
+    const auto& dgj = delta_g[j];
+    for (size_t i=0; i<n; ++i)
+      g[indices[i]] -= gamma[j]*dgj[i];
+  }
+}
+
+//###################################################################
+/**Solves a small dense system with partial pivoting. Returns false if
+ * the system is singular.*/
+bool LinearBoltzmann::AndersonAccelerator::
+  SolveDense(std::vector<std::vector<double>>& A, std::vector<double>& b)
+{
+  const size_t m = b.size();
+  for (size_t c=0; c<m; ++c)
+  {
+    size_t pivot = c;
+    for (size_t r=c+1; r<m; ++r)
+      if (std::fabs(A[r][c]) > std::fabs(A[pivot][c])) pivot = r;
+    if (std::fabs(A[pivot][c]) < 1.0e-300) return false;
+
+    std::swap(A[c], A[pivot]);
+    std::swap(b[c], b[pivot]);
+
+    for (size_t r=c+1; r<m; ++r)
+    {
+      double factor = A[r][c]/A[c][c];
+      for (size_t k=c; k<m; ++k)
+        A[r][k] -= factor*A[c][k];
+      b[r] -= factor*b[c];
+    }
+  }
+
+  for (size_t c=m; c-- > 0;)
+  {
+    for (size_t k=c+1; k<m; ++k)
+      b[c] -= A[c][k]*b[k];
+    b[c] /= A[c][c];
+  }
+  return true;
+}
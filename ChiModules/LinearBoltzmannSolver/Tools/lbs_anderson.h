@@ -0,0 +1,48 @@
+#ifndef LBS_ANDERSON_H
+#define LBS_ANDERSON_H
+
+#include <vector>
+#include <cstddef>
+
+namespace LinearBoltzmann
+{
+  class AndersonAccelerator;
+}
+
+//###################################################################
+/**Anderson mixing for fixed-point iterations x_{k+1} = g(x_k).
+ *
+ * Keeps the differences of the last depth residuals f = g(x) - x and
+ * map values g(x), and replaces g(x_k) with
+ * g(x_k) - dG*gamma where gamma minimizes ||f_k - dF*gamma||. Only the
+ * entries listed in the index set take part, which restricts the mixing
+ * to a groupset. The Gram matrix of dF is updated incrementally so that
+ * each step needs a single allreduce of 2*depth values and no extra
+ * sweep.*/
+class LinearBoltzmann::AndersonAccelerator
+{
+private:
+  const size_t              depth;
+  const std::vector<size_t> indices;
+
+  std::vector<std::vector<double>> delta_f; ///< Circular, [depth][n]
+  std::vector<std::vector<double>> delta_g; ///< Circular, [depth][n]
+  std::vector<std::vector<double>> gram;    ///< dF^T dF, [depth][depth]
+  std::vector<double> f_prev;
+  std::vector<double> g_prev;
+  size_t num_stored = 0;
+  size_t head = 0;
+  bool   has_prev = false;
+
+public:
+  AndersonAccelerator(size_t in_depth, std::vector<size_t> in_indices);
+
+  void Reset();
+  void Mix(const std::vector<double>& x, std::vector<double>& g);
+
+private:
+  static bool SolveDense(std::vector<std::vector<double>>& A,
+                         std::vector<double>& b);
+};
+
+#endif
@@ -0,0 +1,93 @@
+#include "lbs_convergence_reduction.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Completes an outstanding reduction so that no request is leaked.*/
+LinearBoltzmann::ConvergenceReduction::~ConvergenceReduction()
+{
+  if (pending)
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+//###################################################################
+/**Adds a metric and returns its index. Must not be called while a
+ * reduction is pending.*/
+size_t LinearBoltzmann::ConvergenceReduction::
+  Add(double max_value, double sum_value)
+{
+  local_values.push_back(max_value);
+  local_values.push_back(sum_value);
+  return local_values.size()/2 - 1;
+}
+
+//###################################################################
+/**Starts the reduction of all metrics added since the last Clear.
+ * Collective over MPI_COMM_WORLD.*/
+void LinearBoltzmann::ConvergenceReduction::Start()
+{
+  global_values.assign(local_values.size(), 0.0);
+  MPI_Iallreduce(local_values.data(), global_values.data(),
+                 static_cast<int>(Size()),
+                 GetPairType(), GetOp(), MPI_COMM_WORLD, &request);
+  pending = true;
+}
+
+//###################################################################
+/**Waits for the reduction started by Start.*/
+void LinearBoltzmann::ConvergenceReduction::Wait()
+{
+  if (not pending) return;
+  MPI_Wait(&request, MPI_STATUS_IGNORE);
+  pending = false;
+}
+
+//###################################################################
+/**Removes all metrics. Waits for a pending reduction first.*/
+void LinearBoltzmann::ConvergenceReduction::Clear()
+{
+  Wait();
+  local_values.clear();
+  global_values.clear();
+}
+
+//###################################################################
+/**Returns a datatype of two contiguous doubles, creating it on first
+ * use. Reducing whole pairs guarantees that the operator never sees a
+ * split pair.*/
+MPI_Datatype LinearBoltzmann::ConvergenceReduction::GetPairType()
+{
+  static MPI_Datatype pair_type = MPI_DATATYPE_NULL;
+  if (pair_type == MPI_DATATYPE_NULL)
+  {
+    MPI_Type_contiguous(2, MPI_DOUBLE, &pair_type);
+    MPI_Type_commit(&pair_type);
+  }
+  return pair_type;
+}
+
+//###################################################################
+/**Returns the reduction operator, creating it on first use. The
+ * operator is freed by MPI_Finalize.*/
+MPI_Op LinearBoltzmann::ConvergenceReduction::GetOp()
+{
+  static MPI_Op op = MPI_OP_NULL;
+  if (op == MPI_OP_NULL)
+    MPI_Op_create(&ConvergenceReduction::MaxSumPairs, /*commute=*/1, &op);
+  return op;
+}
+
+//###################################################################
+/**User-defined MPI operator on len pairs. The first entry of a pair is
+ * combined with max and the second with sum.*/
+void LinearBoltzmann::ConvergenceReduction::
+  MaxSumPairs(void* in, void* inout, int* len, MPI_Datatype*)
+{
+  auto a = static_cast<double*>(in);
+  auto b = static_cast<double*>(inout);
+  for (int p=0; p<*len; ++p)
+  {
+    b[2*p]   = std::max(a[2*p], b[2*p]);
+    b[2*p+1] = a[2*p+1] + b[2*p+1];
+  }
+}
@@ -0,0 +1,55 @@
+#ifndef LBS_CONVERGENCE_REDUCTION_H
+#define LBS_CONVERGENCE_REDUCTION_H
+
+#include <mpi.h>
+
+#include <vector>
+#include <cstddef>
+
+namespace LinearBoltzmann
+{
+  class ConvergenceReduction;
+}
+
+//###################################################################
+/**Batches convergence metrics into a single nonblocking allreduce.
+ *
+ * Every metric is a pair of a value reduced with MAX, e.g. a point-wise
+ * change, and a value reduced with SUM, e.g. a squared L2 norm. Metrics
+ * of several groupsets or eigenvalue quantities can be added before the
+ * reduction is started, after which any work can proceed until Wait
+ * is called.*/
+class LinearBoltzmann::ConvergenceReduction
+{
+private:
+  std::vector<double> local_values;  ///< Pairs (max, sum)
+  std::vector<double> global_values; ///< Pairs (max, sum)
+  MPI_Request         request = MPI_REQUEST_NULL;
+  bool                pending = false;
+
+public:
+  ConvergenceReduction() = default;
+  ~ConvergenceReduction();
+
+  ConvergenceReduction(const ConvergenceReduction&) = delete;
+  ConvergenceReduction& operator=(const ConvergenceReduction&) = delete;
+
+  size_t Add(double max_value, double sum_value);
+  void   Start();
+  void   Wait();
+  void   Clear();
+
+  bool   Pending() const {return pending;}
+  size_t Size() const {return local_values.size()/2;}
+
+  double Max(size_t metric) const {return global_values[2*metric];}
+  double Sum(size_t metric) const {return global_values[2*metric+1];}
+
+private:
+  static MPI_Datatype GetPairType();
+  static MPI_Op GetOp();
+  static void   MaxSumPairs(void* in, void* inout, int* len,
+                            MPI_Datatype* datatype);
+};
+
+#endif
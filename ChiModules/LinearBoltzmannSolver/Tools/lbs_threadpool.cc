@@ -0,0 +1,97 @@
+#include "lbs_threadpool.h"
+
+//###################################################################
+/**Spawns num_threads-1 workers. The calling thread is the remaining
+ * thread.*/
+LinearBoltzmann::ThreadPool::ThreadPool(size_t num_threads)
+{
+  if (num_threads < 1) num_threads = 1;
+
+  workers.reserve(num_threads-1);
+  for (size_t t=1; t<num_threads; ++t)
+    workers.emplace_back(&ThreadPool::WorkerLoop, this, t);
+}
+
+//###################################################################
+/**Signals all workers to stop and joins them.*/
+LinearBoltzmann::ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  cv_work.notify_all();
+
+  for (auto& worker : workers)
+    worker.join();
+}
+
+//###################################################################
+/**Executes in_task for every item in [0,in_num_items) and returns
+ * once all items are done.*/
+void LinearBoltzmann::ThreadPool::
+  ParallelFor(size_t in_num_items, const TaskF& in_task)
+{
+  if (in_num_items == 0) return;
+
+  //============================================= Serial shortcut
+  if (workers.empty() or in_num_items == 1)
+  {
+    for (size_t i=0; i<in_num_items; ++i)
+      in_task(i,0);
+    return;
+  }
+
+  //============================================= Publish work
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    task       = &in_task;
+    num_items  = in_num_items;
+    next_item  = 0;
+    num_active = workers.size();
+    ++generation;
+  }
+  cv_work.notify_all();
+
+  ProcessItems(0);
+
+  //============================================= Wait for workers
+  std::unique_lock<std::mutex> lock(mutex);
+  cv_done.wait(lock, [this]{return num_active == 0;});
+  task = nullptr;
+}
+
+//###################################################################
+/**Main loop of a worker thread.*/
+void LinearBoltzmann::ThreadPool::WorkerLoop(size_t thread_id)
+{
+  size_t last_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv_work.wait(lock, [this,last_generation]
+        {return stop or generation != last_generation;});
+      if (stop) return;
+      last_generation = generation;
+    }
+
+    ProcessItems(thread_id);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      --num_active;
+    }
+    cv_done.notify_one();
+  }
+}
+
+//###################################################################
+/**Grabs items until none are left.*/
+void LinearBoltzmann::ThreadPool::ProcessItems(size_t thread_id)
+{
+  const TaskF& func = *task;
+  const size_t n = num_items;
+  for (size_t i = next_item++; i < n; i = next_item++)
+    func(i, thread_id);
+}
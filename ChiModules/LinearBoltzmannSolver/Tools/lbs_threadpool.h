@@ -0,0 +1,59 @@
+#ifndef LBS_THREADPOOL_H
+#define LBS_THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+namespace LinearBoltzmann
+{
+  class ThreadPool;
+}
+
+//###################################################################
+/**Light-weight fork-join pool of persistent worker threads.
+ * The calling thread participates as thread 0 so that a pool of
+ * size N spawns N-1 workers. Work items of a ParallelFor call are
+ * handed out dynamically and the call only returns once every item
+ * has been processed, i.e. each call acts as a barrier.*/
+class LinearBoltzmann::ThreadPool
+{
+public:
+  /**Work function signature. Arguments are the item index and the
+   * index of the thread executing it (0 <= thread_id < NumThreads()).*/
+  typedef std::function<void(size_t item, size_t thread_id)> TaskF;
+
+private:
+  std::vector<std::thread> workers;
+
+  std::mutex               mutex;
+  std::condition_variable  cv_work;
+  std::condition_variable  cv_done;
+
+  const TaskF*             task = nullptr;
+  size_t                   num_items = 0;
+  std::atomic<size_t>      next_item{0};
+  size_t                   num_active = 0;
+  size_t                   generation = 0;
+  bool                     stop = false;
+
+public:
+  explicit ThreadPool(size_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  size_t NumThreads() const {return workers.size() + 1;}
+
+  void ParallelFor(size_t in_num_items, const TaskF& in_task);
+
+private:
+  void WorkerLoop(size_t thread_id);
+  void ProcessItems(size_t thread_id);
+};
+
+#endif
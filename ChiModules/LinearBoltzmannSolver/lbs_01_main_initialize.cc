@@ -23,6 +23,10 @@ void LinearBoltzmann::Solver::Initialize()
   PrintSimHeader();
   MPI_Barrier(MPI_COMM_WORLD);
 
+  //================================================== Invalidate cached
+  //                                                   sweep structures
+  sweep_cache.Clear();
+
   //================================================== Add unique material ids
   std::set<int> unique_material_ids;
   int invalid_mat_cell_count = 0;
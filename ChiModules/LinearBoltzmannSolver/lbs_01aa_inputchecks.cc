@@ -54,6 +54,9 @@ void LinearBoltzmann::Solver::PerformInputChecks()
     exit(EXIT_FAILURE);
   }
 
+  //======================================== Precompute face neighbor indices
+  grid->EstablishNeighborIndices();
+
   //======================================== Determine geometry type
   if (grid->local_cells[0].Type() == chi_mesh::CellType::SLAB)
   {
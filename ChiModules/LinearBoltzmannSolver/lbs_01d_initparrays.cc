@@ -110,6 +110,7 @@ void LinearBoltzmann::Solver::InitializeParrays()
       int mat_id = cell.material_id;
 
       cell_lbs_view.xs_id = matid_to_xs_map[mat_id];
+      cell_lbs_view.src_id = matid_to_src_map[mat_id];
 
       cell_lbs_view.dof_phi_map_start = block_MG_counter;
       block_MG_counter += fe_intgrl_values.NumNodes() * num_grps * num_moments;
@@ -161,6 +162,9 @@ void LinearBoltzmann::Solver::InitializeParrays()
       cell_transport_views.push_back(cell_lbs_view);
       grid_nodal_mappings.push_back(cell_nodal_mapping);
     }//for local cell
+
+    //Boundary ids were reassigned above
+    grid->InvalidatePackedView();
   }//if empty
 
   //================================================== Initialize Field Functions
@@ -1,5 +1,6 @@
 #include "lbs_linear_boltzmann_solver.h"
 #include "IterativeMethods/lbs_iterativemethods.h"
+#include "SweepChunks/lbs_sweepchunk_pwl.h"
 
 #include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
 
@@ -19,36 +20,59 @@ extern ChiConsole&  chi_console;
 void LinearBoltzmann::Solver::Execute()
 {
   MPI_Barrier(MPI_COMM_WORLD);
-  int gs=-1;
-  for (auto& groupset : group_sets)
-  {
-    ++gs;
-    chi_log.Log(LOG_0)
-      << "\n********* Initializing Groupset " << gs << "\n" << std::endl;
-
-    groupset.BuildDiscMomOperator(options.scattering_order,
-                                  options.geometry_type);
-    groupset.BuildMomDiscOperator(options.scattering_order,
-                                  options.geometry_type);
-    groupset.BuildSubsets();
-
-    ComputeSweepOrderings(groupset);
-    InitFluxDataStructures(groupset);
 
-    InitWGDSA(groupset);
-    InitTGDSA(groupset);
-
-    SolveGroupset(groupset, gs);
+  if (options.ags_scheme != AGSScheme::NONE and group_sets.size() > 1)
+    AcrossGroupsetIterations();
+  else
+  {
+    int gs=-1;
+    for (auto& groupset : group_sets)
+    {
+      ++gs;
+      InitializeGroupset(groupset, gs);
+      SolveGroupset(groupset, gs);
+      CleanUpGroupset(groupset);
+
+      MPI_Barrier(MPI_COMM_WORLD);
+    }
+  }
 
-    CleanUpWGDSA(groupset);
-    CleanUpTGDSA(groupset);
+  chi_log.Log(LOG_0) << "NPTransport solver execution completed\n";
+}
 
-    ResetSweepOrderings(groupset);
+//###################################################################
+/**Builds the operators, sweep structures and DSA solvers of a
+ * groupset.*/
+void LinearBoltzmann::Solver::InitializeGroupset(LBSGroupset& groupset,
+                                                 int group_set_num)
+{
+  chi_log.Log(LOG_0)
+    << "\n********* Initializing Groupset " << group_set_num
+    << "\n" << std::endl;
+
+  groupset.BuildDiscMomOperator(options.scattering_order,
+                                options.geometry_type);
+  groupset.BuildMomDiscOperator(options.scattering_order,
+                                options.geometry_type);
+  groupset.BuildSubsets();
+  BuildGroupsetSourceCSR(groupset);
+  LogFixedSourceCache(groupset);
+
+  ComputeSweepOrderings(groupset);
+  InitFluxDataStructures(groupset);
+
+  InitWGDSA(groupset);
+  InitTGDSA(groupset);
+}
 
-    MPI_Barrier(MPI_COMM_WORLD);
-  }
+//###################################################################
+/**Releases the DSA solvers and sweep structures of a groupset.*/
+void LinearBoltzmann::Solver::CleanUpGroupset(LBSGroupset& groupset)
+{
+  CleanUpWGDSA(groupset);
+  CleanUpTGDSA(groupset);
 
-  chi_log.Log(LOG_0) << "NPTransport solver execution completed\n";
+  ResetSweepOrderings(groupset);
 }
 
 
@@ -59,11 +83,15 @@ void LinearBoltzmann::Solver::SolveGroupset(LBSGroupset& groupset,
 {
   source_event_tag = chi_log.GetRepeatingEventTag("Set Source");
 
+  //Sources from other groupsets may have changed since the last solve
+  q_fixed_groupset = nullptr;
+
   //================================================== Setting up required
   //                                                   sweep chunks
   SweepChunk* sweep_chunk = SetSweepChunk(groupset);
-  MainSweepScheduler sweepScheduler(SchedulingAlgorithm::DEPTH_OF_GRAPH,
+  MainSweepScheduler sweepScheduler(groupset.sweep_scheduling_algorithm,
                                     &groupset.angle_agg);
+  groupset.angle_agg.ReportFLUDSMemory();
 
   if (groupset.iterative_method == NPT_CLASSICRICHARDSON)
   {
@@ -74,6 +102,10 @@ void LinearBoltzmann::Solver::SolveGroupset(LBSGroupset& groupset,
     GMRES(groupset, group_set_num, sweep_chunk, sweepScheduler);
   }
 
+  auto pwl_chunk = dynamic_cast<LBSSweepChunkPWL*>(sweep_chunk);
+  if (pwl_chunk and groupset.sweep_cache_max_mb > 0.0)
+    pwl_chunk->LogCellMatrixCacheStatistics();
+
   delete sweep_chunk;
 
   if (options.write_restart_data)
@@ -25,7 +25,8 @@ typedef chi_mesh::sweep_management::AngleSetGroup TAngleSetGroup;
 extern ChiConsole&  chi_console;
 
 //###################################################################
-/**Initializes the sweep ordering for the given groupset.*/
+/**Initializes the sweep ordering for the given groupset. Orderings are
+ * taken from the solver's sweep structure cache when available.*/
 void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset)
 {
   chi_log.Log(LOG_0)
@@ -39,6 +40,16 @@ void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset)
   chi_mesh::MeshHandler*    mesh_handler = chi_mesh::GetCurrentHandler();
   chi_mesh::VolumeMesher*         mesher = mesh_handler->volume_mesher;
 
+  //============================================= Reorder level ties to
+  //                                              lower FLUDS memory
+  bool reorder_ties = groupset.fluds_reorder_ties;
+  if (reorder_ties and groupset.sweep_num_threads > 1)
+  {
+    chi_log.Log(LOG_0WARNING)
+      << "FLUDS tie reordering has no effect on threaded sweeps.";
+    reorder_ties = false;
+  }
+
   //============================================= Check possibility of cycles
   if (mesher->options.partition_type ==
       chi_mesh::VolumeMesher::PartitionType::PARMETIS and
@@ -56,11 +67,11 @@ void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset)
     for (auto& angle : groupset.quadrature->abscissae)
     {
       auto new_swp_order =
-        chi_mesh::sweep_management::
-        CreateSweepOrder(angle.theta,
-                         angle.phi,
-                         this->grid,
-                         groupset.allow_cycles);
+        sweep_cache.GetSPDS(angle.theta,
+                            angle.phi,
+                            this->grid,
+                            groupset.allow_cycles,
+                            reorder_ties);
       groupset.sweep_orderings.push_back(new_swp_order);
     }
   }
@@ -85,19 +96,19 @@ void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset)
       }
 
       auto new_swp_order =
-        chi_mesh::sweep_management::
-        CreateSweepOrder(product_quadrature->polar_ang[0],
-                         product_quadrature->azimu_ang[0],
-                         this->grid,
-                         groupset.allow_cycles);
+        sweep_cache.GetSPDS(product_quadrature->polar_ang[0],
+                            product_quadrature->azimu_ang[0],
+                            this->grid,
+                            groupset.allow_cycles,
+                            reorder_ties);
       groupset.sweep_orderings.push_back(new_swp_order);
 
       new_swp_order =
-        chi_mesh::sweep_management::
-        CreateSweepOrder(product_quadrature->polar_ang[pa],
-                         product_quadrature->azimu_ang[0],
-                         this->grid,
-                         groupset.allow_cycles);
+        sweep_cache.GetSPDS(product_quadrature->polar_ang[pa],
+                            product_quadrature->azimu_ang[0],
+                            this->grid,
+                            groupset.allow_cycles,
+                            reorder_ties);
       groupset.sweep_orderings.push_back(new_swp_order);
     }
 
@@ -140,22 +151,22 @@ void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset)
       for (int i=0; i<num_azi; i++)
       {
         auto new_swp_order =
-          chi_mesh::sweep_management::
-          CreateSweepOrder(product_quadrature->polar_ang[pa-1],
-                           product_quadrature->azimu_ang[i],
-                           this->grid,
-                           groupset.allow_cycles);
+          sweep_cache.GetSPDS(product_quadrature->polar_ang[pa-1],
+                              product_quadrature->azimu_ang[i],
+                              this->grid,
+                              groupset.allow_cycles,
+                              reorder_ties);
         groupset.sweep_orderings.push_back(new_swp_order);
       }
       //=========================================== BOTTOM HEMISPHERE
       for (int i=0; i<num_azi; i++)
       {
         auto new_swp_order =
-          chi_mesh::sweep_management::
-          CreateSweepOrder(product_quadrature->polar_ang[pa],
-                           product_quadrature->azimu_ang[i],
-                           this->grid,
-                           groupset.allow_cycles);
+          sweep_cache.GetSPDS(product_quadrature->polar_ang[pa],
+                              product_quadrature->azimu_ang[i],
+                              this->grid,
+                              groupset.allow_cycles,
+                              reorder_ties);
         groupset.sweep_orderings.push_back(new_swp_order);
       }
     }//if product quadrature
@@ -168,7 +179,6 @@ void LinearBoltzmann::Solver::ComputeSweepOrderings(LBSGroupset& groupset)
     exit(EXIT_FAILURE);
   }
 
-
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
     << " Done computing sweep orderings.           Process memory = "
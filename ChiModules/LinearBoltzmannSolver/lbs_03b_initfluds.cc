@@ -2,6 +2,7 @@
 #include "ChiConsole/chi_console.h"
 
 #include <ChiMesh/SweepUtilities/FLUDS/FLUDS.h>
+#include <ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h>
 #include <ChiMesh/MeshHandler/chi_meshhandler.h>
 #include <ChiMesh/VolumeMesher/Linemesh1D/volmesher_linemesh1d.h>
 #include <ChiMesh/VolumeMesher/Predefined2D/volmesher_predefined2d.h>
@@ -46,6 +47,21 @@ void LinearBoltzmann::Solver::InitFluxDataStructures(LBSGroupset& groupset)
     InitAngleAggSingle(groupset);
   }
 
+  //================================================== Message aggregation
+  groupset.angle_agg.message_aggregator = nullptr;
+  if (options.sweep_aggregation_threshold > 0)
+    groupset.angle_agg.message_aggregator =
+      std::make_shared<chi_mesh::sweep_management::SweepMessageAggregator>(
+        options.sweep_aggregation_threshold, &grid->GetCommunicator());
+
+  //================================================== Local psi arena
+  if (not local_psi_arena)
+    local_psi_arena = std::make_shared<chi_mesh::sweep_management::FLUDSArena>();
+  groupset.angle_agg.local_psi_arena = local_psi_arena;
+
+  //================================================== Sweep plan
+  sweep_cache.WritePlan();
+
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
     << " Initialized Angle Aggregation.   "
@@ -32,6 +32,9 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
     << chi_program_timer.GetTimeString()
     << " Initializing angle aggregation: Polar";
 
+  //Threaded sweeps need FLUDS slots that are safe across a sweep level
+  const bool concurrent_levels = groupset.sweep_num_threads > 1;
+
   if (groupset.quadrature->type !=
     chi_math::AngularQuadratureType::ProductQuadrature)
   {
@@ -74,7 +77,7 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
     {
       bool make_primary = true;
-      chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
+      std::shared_ptr<chi_mesh::sweep_management::PRIMARY_FLUDS> primary_fluds;
 
       for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
       {
@@ -91,31 +94,19 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
             angle_indices.push_back(angle_num);
           }//for pr
 
-          chi_mesh::sweep_management::FLUDS* fluds;
           if (make_primary)
           {
             make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-                  PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
-                                grid_nodal_mappings);
-
-            chi_log.Log(LOG_0VERBOSE_1)
-              << "Initializing FLUDS for omega="
-              << groupset.sweep_orderings[a]->omega.PrintS()
-              << "         Process memory = "
-              << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
-              << " MB.";
-
-            primary_fluds->InitializeAlphaElements(groupset.sweep_orderings[a]);
-            primary_fluds->InitializeBetaElements(groupset.sweep_orderings[a]);
-
-            fluds = primary_fluds;
-          } else
-          {
-            fluds = new chi_mesh::sweep_management::
-              AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+            primary_fluds = sweep_cache.GetPrimaryFLUDS(
+              groupset.sweep_orderings[a],
+              groupset.grp_subset_sizes[gs_ss],
+              grid_nodal_mappings, concurrent_levels);
           }
 
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
+            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+
           auto angleSet = std::make_shared<TAngleSet>(
                           groupset.grp_subset_sizes[gs_ss],
                           gs_ss,
@@ -140,7 +131,7 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
     {
       bool make_primary = true;
-      chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
+      std::shared_ptr<chi_mesh::sweep_management::PRIMARY_FLUDS> primary_fluds;
 
       for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
       {
@@ -157,31 +148,19 @@ void LinearBoltzmann::Solver::InitAngleAggPolar(LBSGroupset& groupset)
             angle_indices.push_back(angle_num);
           }//for pr
 
-          chi_mesh::sweep_management::FLUDS* fluds;
           if (make_primary)
           {
             make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
-                          grid_nodal_mappings);
-
-            chi_log.Log(LOG_0VERBOSE_1)
-              << "Initializing FLUDS for omega="
-              << groupset.sweep_orderings[a+num_azi]->omega.PrintS()
-              << "         Process memory = "
-              << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
-              << " MB.";
-
-            primary_fluds->InitializeAlphaElements(groupset.sweep_orderings[a+num_azi]);
-            primary_fluds->InitializeBetaElements(groupset.sweep_orderings[a+num_azi]);
-
-            fluds = primary_fluds;
-          } else
-          {
-            fluds = new chi_mesh::sweep_management::
-            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+            primary_fluds = sweep_cache.GetPrimaryFLUDS(
+              groupset.sweep_orderings[a+num_azi],
+              groupset.grp_subset_sizes[gs_ss],
+              grid_nodal_mappings, concurrent_levels);
           }
 
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
+            AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
+
           auto angleSet = std::make_shared<TAngleSet>(
                           groupset.grp_subset_sizes[gs_ss],
                           gs_ss,
@@ -209,6 +188,9 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
     << chi_program_timer.GetTimeString()
     << " Initializing angle aggregation: Single";
 
+  //Threaded sweeps need FLUDS slots that are safe across a sweep level
+  const bool concurrent_levels = groupset.sweep_num_threads > 1;
+
   if (groupset.quadrature->type ==
       chi_math::AngularQuadratureType::ProductQuadrature)
   {
@@ -242,7 +224,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
         for (int pr=0; pr<pa; pr++)
         {
           bool make_primary = true;
-          chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
+          std::shared_ptr<chi_mesh::sweep_management::PRIMARY_FLUDS> primary_fluds;
 
           for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
           {
@@ -254,31 +236,18 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
             int angle_num = product_quadrature->GetAngleNum(p,a);
             angle_indices.push_back(angle_num);
 
-            chi_mesh::sweep_management::FLUDS* fluds;
             if (make_primary)
             {
               make_primary = false;
-              primary_fluds = new chi_mesh::sweep_management::
-                PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
-                              grid_nodal_mappings);
-
-              chi_log.Log(LOG_0VERBOSE_1)
-                << "Initializing FLUDS for omega="
-                << groupset.sweep_orderings[angle_num]->omega.PrintS()
-                << "         Process memory = "
-                << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
-                << " MB.";
-
-              primary_fluds->InitializeAlphaElements(groupset.sweep_orderings[angle_num]);
-              primary_fluds->InitializeBetaElements(groupset.sweep_orderings[angle_num]);
-
-              fluds = primary_fluds;
+              primary_fluds = sweep_cache.GetPrimaryFLUDS(
+                groupset.sweep_orderings[angle_num],
+                groupset.grp_subset_sizes[gs_ss],
+                grid_nodal_mappings, concurrent_levels);
             }
-            else
-            {
-              fluds = new chi_mesh::sweep_management::
+
+            chi_mesh::sweep_management::FLUDS* fluds =
+              new chi_mesh::sweep_management::
               AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
-            }
 
             auto angleSet = std::make_shared<TAngleSet>(
                             groupset.grp_subset_sizes[gs_ss],
@@ -308,7 +277,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
         for (int pr=0; pr<pa; pr++)
         {
           bool make_primary = true;
-          chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
+          std::shared_ptr<chi_mesh::sweep_management::PRIMARY_FLUDS> primary_fluds;
 
           for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
           {
@@ -320,31 +289,18 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
             int angle_num = product_quadrature->GetAngleNum(p,a);
             angle_indices.push_back(angle_num);
 
-            chi_mesh::sweep_management::FLUDS* fluds;
             if (make_primary)
             {
               make_primary = false;
-              primary_fluds = new chi_mesh::sweep_management::
-              PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
-                            grid_nodal_mappings);
-
-              chi_log.Log(LOG_0VERBOSE_1)
-                << "Initializing FLUDS for omega="
-                << groupset.sweep_orderings[angle_num]->omega.PrintS()
-                << "         Process memory = "
-                << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
-                << " MB.";
-
-              primary_fluds->InitializeAlphaElements(groupset.sweep_orderings[angle_num]);
-              primary_fluds->InitializeBetaElements(groupset.sweep_orderings[angle_num]);
-
-              fluds = primary_fluds;
+              primary_fluds = sweep_cache.GetPrimaryFLUDS(
+                groupset.sweep_orderings[angle_num],
+                groupset.grp_subset_sizes[gs_ss],
+                grid_nodal_mappings, concurrent_levels);
             }
-            else
-            {
-              fluds = new chi_mesh::sweep_management::
+
+            chi_mesh::sweep_management::FLUDS* fluds =
+              new chi_mesh::sweep_management::
               AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
-            }
 
             auto angleSet = std::make_shared<TAngleSet>(
                             groupset.grp_subset_sizes[gs_ss],
@@ -384,7 +340,7 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
       for (int n=0; n<groupset.quadrature->abscissae.size(); ++n)
       {
         bool make_primary = true;
-        chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
+        std::shared_ptr<chi_mesh::sweep_management::PRIMARY_FLUDS> primary_fluds;
 
         for (int gs_ss=0; gs_ss<groupset.grp_subsets.size(); gs_ss++)
         {
@@ -392,45 +348,18 @@ void LinearBoltzmann::Solver::InitAngleAggSingle(LBSGroupset& groupset)
 
           angle_indices.push_back(n);
 
-          chi_mesh::sweep_management::FLUDS* fluds;
           if (make_primary)
           {
             make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-              PRIMARY_FLUDS(groupset.grp_subset_sizes[gs_ss],
-                            grid_nodal_mappings);
-
-            chi_log.Log(LOG_0VERBOSE_1)
-              << "Initializing FLUDS for omega="
-              << groupset.sweep_orderings[n]->omega.PrintS()
-              << "         Process memory = "
-              << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
-              << " MB.";
-
-            try{primary_fluds->InitializeAlphaElements(groupset.sweep_orderings[n]);}
-            catch (const std::exception& exc)
-            {
-              chi_log.Log(LOG_ALLERROR)
-                << "Unknown error in PRIMARY_FLUDS::\n"
-                   "InitializeAlphaElements. " << exc.what();
-              exit(EXIT_FAILURE);
-            }
-            try{primary_fluds->InitializeBetaElements(groupset.sweep_orderings[n]);}
-            catch (const std::exception& exc)
-            {
-              chi_log.Log(LOG_ALLERROR)
-                << "Unknown error in PRIMARY_FLUDS::\n"
-                   "InitializeBetaElements. " << exc.what();
-              exit(EXIT_FAILURE);
-            }
-
-            fluds = primary_fluds;
+            primary_fluds = sweep_cache.GetPrimaryFLUDS(
+              groupset.sweep_orderings[n],
+              groupset.grp_subset_sizes[gs_ss],
+              grid_nodal_mappings, concurrent_levels);
           }
-          else
-          {
-            fluds = new chi_mesh::sweep_management::
+
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
             AUX_FLUDS(*primary_fluds,groupset.grp_subset_sizes[gs_ss]);
-          }
 
           auto angleSet = std::make_shared<TAngleSet>(
                           groupset.grp_subset_sizes[gs_ss],
@@ -13,7 +13,8 @@ extern ChiMPI& chi_mpi;
 
 //###################################################################
 /**Clears all the sweep orderings for a groupset in preperation for
- * another.*/
+ * another. The SPDS and primary FLUDS remain in the solver's sweep
+ * structure cache unless caching is disabled.*/
 void LinearBoltzmann::Solver::ResetSweepOrderings(LBSGroupset& groupset)
 {
   chi_log.Log(LOG_0VERBOSE_1)
@@ -32,6 +33,11 @@ void LinearBoltzmann::Solver::ResetSweepOrderings(LBSGroupset& groupset)
     angset_grp.angle_sets.clear();
   }
   angle_agg.angle_set_groups.clear();
+  angle_agg.message_aggregator = nullptr;
+
+  if (not sweep_cache.enabled)
+    sweep_cache.Clear();
+  sweep_cache.LogStatistics();
 
   MPI_Barrier(MPI_COMM_WORLD);
 
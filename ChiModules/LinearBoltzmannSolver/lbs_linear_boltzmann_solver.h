@@ -12,6 +12,9 @@
 #include "ChiMesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
 #include "ChiMath/SparseMatrix/chi_math_sparse_matrix.h"
 #include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/SweepStructureCache/sweep_structure_cache.h"
+#include "Tools/lbs_threadpool.h"
+#include "Tools/lbs_convergence_reduction.h"
 
 #include <petscksp.h>
 
@@ -72,6 +75,10 @@ public:
   std::vector<std::vector<double>>                  incident_P0_mg_boundaries;
   std::vector<double>                               zero_boundary;
   std::vector<std::shared_ptr<SweepBndry>>          sweep_boundaries;
+  ///Local psi storage shared by all the anglesets of all groupsets
+  std::shared_ptr<sweep_namespace::FLUDSArena>      local_psi_arena;
+  ///SPDS and FLUDS shared by all groupsets and executions
+  sweep_namespace::SweepStructureCache              sweep_cache;
 
   chi_math::UnknownManager flux_moments_uk_man;
 
@@ -84,6 +91,14 @@ public:
   std::vector<double> phi_new_local, phi_old_local;
   std::vector<double> delta_phi_local;
 
+  ///Material plus across-groupset source of the groupset groups, valid
+  ///for q_fixed_groupset during its solve
+  std::vector<double> q_fixed_local;
+  const LBSGroupset*  q_fixed_groupset = nullptr;
+
+  ///Threads used by SetSource, sized by the groupset's sweep threads
+  std::unique_ptr<ThreadPool> source_thread_pool;
+
  public:
   //00
   Solver();
@@ -104,8 +119,10 @@ public:
   virtual void InitializeParrays();
   //02
   void Execute() override;
+  void InitializeGroupset(LBSGroupset& groupset, int group_set_num);
   void SolveGroupset(LBSGroupset& groupset,
                      int group_set_num);
+  void CleanUpGroupset(LBSGroupset& groupset);
 
   //03a
   void ComputeSweepOrderings(LBSGroupset& groupset);
@@ -140,7 +157,13 @@ public:
   virtual void SetSource(LBSGroupset& groupset,
                  bool apply_mat_src,
                  bool suppress_phi_old);
+  void BuildGroupsetSourceCSR(LBSGroupset& groupset);
+  void LogFixedSourceCache(LBSGroupset& groupset);
   double ComputePiecewiseChange(LBSGroupset& groupset);
+  size_t PostSweepUpdate(LBSGroupset& groupset,
+                         ConvergenceReduction& reduction,
+                         bool copy_to_old);
+  double ComputeAGSPiecewiseChange(const std::vector<double>& phi_prev_local);
   SweepChunk *SetSweepChunk(LBSGroupset& groupset);
   void ClassicRichardson(LBSGroupset& groupset,
                          int group_set_num,
@@ -152,11 +175,14 @@ public:
              SweepChunk* sweep_chunk,
              MainSweepScheduler & sweepScheduler,
              bool log_info = true);
+  void AcrossGroupsetIterations();
 
   //Vector assembly
+  bool IsGroupsetContiguous(LBSGroupset& groupset);
   void AssembleVector(LBSGroupset& groupset, Vec x, double *y,bool with_delayed_psi=false);
   void DisAssembleVector(LBSGroupset& groupset, Vec x_src, double *y,bool with_delayed_psi=false);
   void DisAssembleVectorLocalToLocal(LBSGroupset& groupset, double *x_src, double *y);
+  std::vector<size_t> GetGroupsetLocalIndices(LBSGroupset& groupset);
 
 };
 
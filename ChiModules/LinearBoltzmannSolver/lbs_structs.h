@@ -19,6 +19,16 @@ enum class GeometryType
   THREED_CARTESIAN = 5
 };
 
+/**Across-groupset iteration schemes. Gauss-Seidel uses the latest flux
+ * of preceding groupsets, Jacobi lags the flux of all other groupsets
+ * by one iteration.*/
+enum class AGSScheme
+{
+  NONE         = 0,
+  GAUSS_SEIDEL = 1,
+  JACOBI       = 2
+};
+
 /**Struct for storing LBS options.*/
 struct Options
 {
@@ -28,6 +38,7 @@ struct Options
   SDMType sd_type = SDMType::UNDEFINED;
   int  scattering_order=1;
   int  sweep_eager_limit= 32000;;
+  int  sweep_aggregation_threshold = 0; ///< Bytes. 0 disables aggregation
 
   bool read_restart_data=false;
   std::string read_restart_folder_name = std::string("YRestart");
@@ -38,6 +49,10 @@ struct Options
   std::string write_restart_file_base   = std::string("restart");
   double write_restart_interval = 30.0;
 
+  AGSScheme ags_scheme = AGSScheme::NONE;
+  int    ags_max_iterations = 100;
+  double ags_tolerance      = 1.0e-6;
+
   int max_iterations = 1000;
   double tolerance    = 1e-8;
   bool use_precursors = false;
@@ -53,6 +68,7 @@ public:
   int dof_phi_map_start = 0;
   int dofs = 0;
   int xs_id = 0;
+  int src_id = -1;
   std::vector<bool> face_local = {};
 
 private:
@@ -1,6 +1,8 @@
 #include "lbs_linear_boltzmann_solver.h"
 #include <ChiMesh/Cell/cell.h>
 
+#include <algorithm>
+
 ////###################################################################
 ///**Maps the local storage location of phi given a cell, the node of
 // * the cell, the moment and the group.*/
@@ -14,6 +16,16 @@
 //  return (address+dof)*num_moments*G + G*mom + g;
 //}
 
+//###################################################################
+/**Returns true when the groupset holds all groups. The groupset's
+ * entries of the local flux moment vectors are then one contiguous
+ * block, in the same order as the assembled vectors, and assembly
+ * reduces to a plain copy.*/
+bool LinearBoltzmann::Solver::IsGroupsetContiguous(LBSGroupset& groupset)
+{
+  return groupset.groups.size() == groups.size();
+}
+
 //###################################################################
 /**Assembles a vector for a given groupset from a source vector.*/
 void LinearBoltzmann::Solver::
@@ -28,6 +40,13 @@ AssembleVector(LBSGroupset& groupset, Vec x, double *y,
   int gss = gsf-gsi+1;
 
   int index = -1;
+  if (IsGroupsetContiguous(groupset))
+  {
+    size_t num_flux_unknowns = local_dof_count*num_moments*gss;
+    std::copy(y, y + num_flux_unknowns, x_ref);
+    index = static_cast<int>(num_flux_unknowns) - 1;
+  }
+  else
   for (const auto& cell : grid->local_cells)
   {
     auto& transport_view = cell_transport_views[cell.local_id];
@@ -67,6 +86,13 @@ DisAssembleVector(LBSGroupset& groupset, Vec x_src, double *y,
   int gss = gsf-gsi+1;
 
   int index = -1;
+  if (IsGroupsetContiguous(groupset))
+  {
+    size_t num_flux_unknowns = local_dof_count*num_moments*gss;
+    std::copy(x_ref, x_ref + num_flux_unknowns, y);
+    index = static_cast<int>(num_flux_unknowns) - 1;
+  }
+  else
   for (const auto& cell : grid->local_cells)
   {
     auto& transport_view = cell_transport_views[cell.local_id];
@@ -124,4 +150,31 @@ DisAssembleVectorLocalToLocal(LBSGroupset& groupset, double* x_src, double *y)
     }//for dof
   }//for cell
 
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Returns the indices of a groupset's entries in the local flux moment
+ * vectors, in the same order as DisAssembleVectorLocalToLocal.*/
+std::vector<size_t> LinearBoltzmann::Solver::
+GetGroupsetLocalIndices(LBSGroupset& groupset)
+{
+  int gsi = groupset.groups[0].id;
+  int gss = groupset.groups.size();
+
+  std::vector<size_t> indices;
+  indices.reserve(local_dof_count*num_moments*gss);
+  for (const auto& cell : grid->local_cells)
+  {
+    auto& transport_view = cell_transport_views[cell.local_id];
+
+    for (int i=0; i < cell.vertex_ids.size(); i++)
+      for (int m=0; m<num_moments; m++)
+      {
+        int mapping = transport_view.MapDOF(i,m,gsi);
+        for (int g=0; g<gss; g++)
+          indices.push_back(mapping + g);
+      }//for moment
+  }//for cell
+
+  return indices;
+}
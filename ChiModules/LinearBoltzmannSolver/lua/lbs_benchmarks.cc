@@ -0,0 +1,132 @@
+#include "ChiLua/chi_lua.h"
+
+#include "../SweepChunks/lbs_cellsolve_kernels.h"
+
+#include "ChiTimer/chi_timer.h"
+
+#include <iomanip>
+
+#include "chi_log.h"
+extern ChiLog& chi_log;
+
+//###################################################################
+/**Times the cell solve kernels of the sweep and reports the number of
+ * cell solves per second for common cell types. For each node count the
+ * specialized kernel is compared to the generic kernel.
+
+\param NumSolves int Optional. Number of solves per cell type.
+                     Default 1000000.
+
+##_
+
+Example:
+\code
+chiLBSCellSolveBenchmark(2000000)
+\endcode
+
+\ingroup LuaNPT
+*/
+int chiLBSCellSolveBenchmark(lua_State *L)
+{
+  int num_args = lua_gettop(L);
+  if (num_args > 1)
+    LuaPostArgAmountError("chiLBSCellSolveBenchmark",1,num_args);
+
+  int num_solves = 1000000;
+  if (num_args == 1)
+  {
+    LuaCheckNilValue("chiLBSCellSolveBenchmark",L,1);
+    num_solves = lua_tonumber(L,1);
+  }
+
+  if (num_solves < 1)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "chiLBSCellSolveBenchmark: Number of solves must be >= 1.";
+    exit(EXIT_FAILURE);
+  }
+
+  const std::vector<std::pair<int,std::string>> cell_types =
+    {{ 2,"Slab"},
+     { 3,"Triangle"},
+     { 4,"Quadrilateral/Tetrahedron"},
+     { 6,"Wedge"},
+     { 8,"Hexahedron"},
+     {12,"Hexagonal prism"}};
+
+  chi_log.Log(LOG_0)
+    << "Cell solve benchmark, " << num_solves << " solves per cell type\n"
+    << std::setw(27) << std::left << "Cell type"
+    << std::setw(7)  << std::right << "Nodes"
+    << std::setw(18) << "Kernel [solves/s]"
+    << std::setw(19) << "Generic [solves/s]"
+    << std::setw(10) << "Speedup";
+
+  ChiTimer timer;
+  for (const auto& cell_type : cell_types)
+  {
+    const int n = cell_type.first;
+
+    //============================================= Build a representative
+    //                                              system
+    MatDbl Amat(n, VecDbl(n, 0.0));
+    MatDbl M(n, VecDbl(n, 0.0));
+    MatDbl Atemp(n, VecDbl(n, 0.0));
+    VecDbl source(n, 1.0);
+    VecDbl b0(n, 0.0);
+    for (int i = 0; i < n; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        Amat[i][j] = 0.1*(i - j) + ((i==j)? 0.5 : 0.0);
+        M[i][j]    = (i==j)? 2.0/(n+1) : 1.0/(n+1);
+      }
+      b0[i] = 0.1*(i+1);
+    }
+    const double sigma_t = 1.0;
+
+    //============================================= Time kernel
+    VecDbl b_kernel(n);
+    double check_kernel = 0.0;
+    timer.Reset();
+    for (int k = 0; k < num_solves; ++k)
+    {
+      b_kernel = b0;
+      LinearBoltzmann::CellSolve::
+        AssembleAndSolve(Amat, M, sigma_t, source, Atemp, b_kernel, n);
+      check_kernel += b_kernel[0];
+    }
+    double time_kernel = timer.GetTime()/1000.0;
+
+    //============================================= Time generic
+    VecDbl b_generic(n);
+    double check_generic = 0.0;
+    timer.Reset();
+    for (int k = 0; k < num_solves; ++k)
+    {
+      b_generic = b0;
+      LinearBoltzmann::CellSolve::
+        AssembleAndSolveGeneric(Amat, M, sigma_t, source, Atemp, b_generic, n);
+      check_generic += b_generic[0];
+    }
+    double time_generic = timer.GetTime()/1000.0;
+
+    if (b_kernel != b_generic or check_kernel != check_generic)
+      chi_log.Log(LOG_ALLWARNING)
+        << "chiLBSCellSolveBenchmark: Kernel and generic solutions differ "
+        << "for " << n << " nodes.";
+
+    double rate_kernel  = num_solves/std::max(time_kernel ,1.0e-12);
+    double rate_generic = num_solves/std::max(time_generic,1.0e-12);
+
+    chi_log.Log(LOG_0)
+      << std::setw(27) << std::left << cell_type.second
+      << std::setw(7)  << std::right << n
+      << std::setw(18) << std::scientific << std::setprecision(3) << rate_kernel
+      << std::setw(19) << rate_generic
+      << std::setw(10) << std::fixed << std::setprecision(2)
+      << rate_kernel/rate_generic;
+  }
+
+  return 0;
+}
@@ -1023,6 +1023,114 @@ int chiLBSGroupsetSetGMRESRestartIntvl(lua_State *L)
   return 0;
 }
 
+//###################################################################
+/**Sets the Krylov method used when the iterative method of this groupset
+ * is NPT_GMRES. The pipelined variants overlap the global reductions of
+ * the orthogonalization with the sweep, at the cost of extra vectors and
+ * slightly reduced stability. The average matrix action (sweep) time and
+ * the remaining Krylov time per iteration are reported after the groupset
+ * solve.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param KrylovType int Krylov method. See below.
+
+##_
+
+###KrylovType
+LBSGroupset.KRYLOV_GMRES\n
+ Default. Classical GMRES (PETSc KSPGMRES).\n\n
+
+LBSGroupset.KRYLOV_PGMRES\n
+ Pipelined GMRES (PETSc KSPPGMRES).\n\n
+
+LBSGroupset.KRYLOV_PIPEFGMRES\n
+ Pipelined flexible GMRES (PETSc KSPPIPEFGMRES).\n\n
+
+Example:
+\code
+chiLBSGroupsetSetKrylovType(phys1,cur_gs,LBSGroupset.KRYLOV_PGMRES)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetKrylovType(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetKrylovType",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetKrylovType",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetKrylovType",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetKrylovType",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int krylov_type  = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetKrylovType: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetKrylovType";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetKrylovType";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Setting Krylov type
+  typedef LinearBoltzmann::KrylovType KType;
+  if      (krylov_type == (int)KType::GMRES)
+    groupset->krylov_type = KType::GMRES;
+  else if (krylov_type == (int)KType::PGMRES)
+    groupset->krylov_type = KType::PGMRES;
+  else if (krylov_type == (int)KType::PIPEFGMRES)
+    groupset->krylov_type = KType::PIPEFGMRES;
+  else
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid Krylov type to groupset " << grpset_index
+      << " in call to chiLBSGroupsetSetKrylovType";
+    exit(EXIT_FAILURE);
+  }
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " Krylov type set to "
+    << krylov_type;
+
+  return 0;
+}
+
 
 //###################################################################
 /**Enables or disables the printing of a sweep log.
@@ -1101,6 +1209,733 @@ int chiLBSGroupsetSetEnableSweepLog(lua_State *L)
   return 0;
 }
 
+//###################################################################
+/**Sets the number of threads used to sweep the cells of this groupset.
+ * Cells on the same sweep level are distributed over the threads. The
+ * results are identical to a single threaded sweep.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param NumThreads int Number of sweep threads. Default 1.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetSweepNumThreads(phys1,cur_gs,8)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetSweepNumThreads(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetSweepNumThreads",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetSweepNumThreads",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetSweepNumThreads",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetSweepNumThreads",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int num_threads  = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetSweepNumThreads: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetSweepNumThreads";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetSweepNumThreads";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Bounds checking
+  if (num_threads < 1)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid number of sweep threads "
+      << "in call to chiLBSGroupsetSetSweepNumThreads. Must be >= 1.";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->sweep_num_threads = num_threads;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " number of sweep threads "
+    << "set to " << num_threads;
+
+  return 0;
+}
+
+//###################################################################
+/**Sets the sweep chunk used to sweep this groupset.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param ChunkType int Sweep chunk type. See below.
+
+##_
+
+###ChunkType
+LBSGroupset.SWEEP_CHUNK_PWLD\n
+ Default. Cell systems are solved one group at a time.\n\n
+
+LBSGroupset.SWEEP_CHUNK_PWLD_GROUP_BATCHED\n
+ The cell systems of all the groups in a group subset are solved together
+ in a single group-vectorized pass. Beneficial for groupsets with many
+ groups per subset.\n\n
+
+Example:
+\code
+chiLBSGroupsetSetSweepChunkType(phys1,cur_gs,LBSGroupset.SWEEP_CHUNK_PWLD_GROUP_BATCHED)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetSweepChunkType(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetSweepChunkType",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetSweepChunkType",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetSweepChunkType",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetSweepChunkType",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int chunk_type   = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetSweepChunkType: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetSweepChunkType";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetSweepChunkType";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Setting chunk type
+  typedef LinearBoltzmann::SweepChunkType ChunkType;
+  if      (chunk_type == (int)ChunkType::PWLD)
+    groupset->sweep_chunk_type = ChunkType::PWLD;
+  else if (chunk_type == (int)ChunkType::PWLD_GROUP_BATCHED)
+    groupset->sweep_chunk_type = ChunkType::PWLD_GROUP_BATCHED;
+  else
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid sweep chunk type to groupset " << grpset_index
+      << " in call to chiLBSGroupsetSetSweepChunkType";
+    exit(EXIT_FAILURE);
+  }
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " sweep chunk type set to "
+    << chunk_type;
+
+  return 0;
+}
+
+//###################################################################
+/**Sets the memory budget of the cache of cell matrices used during
+sweeps. Cell streaming matrices do not change between sweeps and are
+stored, per cell and angle, the first time they are assembled. When every
+group subset holds a single group the factored cell systems are stored
+instead. Cells are cached in local order until the budget is exhausted.
+The statistics of the cache are reported after the groupset solve.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param MaxMegabytes float Memory budget per location in megabytes.
+                          Default 0.0 (no caching).
+
+Example:
+\code
+chiLBSGroupsetSetCellMatrixCache(phys1,cur_gs,512.0)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetCellMatrixCache(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetCellMatrixCache",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetCellMatrixCache",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetCellMatrixCache",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetCellMatrixCache",L,3);
+  int    solver_index = lua_tonumber(L,1);
+  int    grpset_index = lua_tonumber(L,2);
+  double max_mb       = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetCellMatrixCache: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetCellMatrixCache";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetCellMatrixCache";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Bounds checking
+  if (max_mb < 0.0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid memory budget "
+      << "in call to chiLBSGroupsetSetCellMatrixCache. Must be >= 0.";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->sweep_cache_max_mb = max_mb;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " cell matrix cache budget "
+    << "set to " << max_mb << " MB";
+
+  return 0;
+}
+
+//###################################################################
+/**Sets the algorithm used to schedule the anglesets during sweeps.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param Scheduler int Scheduling algorithm. See below.
+
+##_
+
+###Scheduler
+LBSGroupset.SWEEP_SCHEDULER_FIFO\n
+ Angleset groups are advanced in turn, first in first out.\n\n
+
+LBSGroupset.SWEEP_SCHEDULER_DEPTH_OF_GRAPH\n
+ Default. Anglesets are ranked by the depth of this location in their
+ sweep graph and by the signs of their direction.\n\n
+
+LBSGroupset.SWEEP_SCHEDULER_CRITICAL_PATH\n
+ Anglesets are ranked by the work remaining on the longest path from this
+ location to the end of their sweep, estimated from the cell counts of all
+ locations. On every scheduling step the ready angleset of highest rank is
+ executed. The predicted and measured sweep efficiencies are reported
+ after the groupset solve.\n\n
+
+Example:
+\code
+chiLBSGroupsetSetSweepScheduler(phys1,cur_gs,LBSGroupset.SWEEP_SCHEDULER_CRITICAL_PATH)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetSweepScheduler(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetSweepScheduler",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetSweepScheduler",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetSweepScheduler",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetSweepScheduler",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int scheduler    = lua_tonumber(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetSweepScheduler: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetSweepScheduler";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetSweepScheduler";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Setting scheduler
+  typedef chi_mesh::sweep_management::SchedulingAlgorithm Algo;
+  if      (scheduler == (int)Algo::FIRST_IN_FIRST_OUT)
+    groupset->sweep_scheduling_algorithm = Algo::FIRST_IN_FIRST_OUT;
+  else if (scheduler == (int)Algo::DEPTH_OF_GRAPH)
+    groupset->sweep_scheduling_algorithm = Algo::DEPTH_OF_GRAPH;
+  else if (scheduler == (int)Algo::CRITICAL_PATH)
+    groupset->sweep_scheduling_algorithm = Algo::CRITICAL_PATH;
+  else
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid sweep scheduler to groupset " << grpset_index
+      << " in call to chiLBSGroupsetSetSweepScheduler";
+    exit(EXIT_FAILURE);
+  }
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " sweep scheduler set to "
+    << scheduler;
+
+  return 0;
+}
+
+//###################################################################
+/**Sets whether the cells within each level of the sweep orderings of
+ * this groupset are reordered to lower the angular flux held in flight
+ * by the FLUDS. Any order within a level is a valid sweep ordering.
+ * The FLUDS memory, including the local psi high-water mark, is reported
+ * at the start of each groupset solve. Must be called before solver
+ * initialization. Has no effect when the sweep uses more than one thread.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param flag bool Flag enabling the reordering. Default false.
+
+Example:
+\code
+chiLBSGroupsetSetFLUDSReorderTies(phys1,cur_gs,true)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetFLUDSReorderTies(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetFLUDSReorderTies",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetFLUDSReorderTies",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetFLUDSReorderTies",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetFLUDSReorderTies",L,3);
+  int  solver_index = lua_tonumber(L,1);
+  int  grpset_index = lua_tonumber(L,2);
+  bool flag         = lua_toboolean(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetFLUDSReorderTies: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetFLUDSReorderTies";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetFLUDSReorderTies";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->fluds_reorder_ties = flag;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " FLUDS tie reordering set to "
+    << ((flag)? "true" : "false");
+
+  return 0;
+}
+
+//###################################################################
+/**Sets the depth of the Anderson acceleration applied to the source
+ * iterations of this groupset, i.e. with NPT_CLASSICRICHARDSON and within
+ * the power iterations of the k-eigenvalue solver. The last depth
+ * iterates are mixed to form the next one, which requires no extra
+ * sweeps and a single global reduction per iteration. A depth of 0
+ * disables the acceleration.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param Depth int Number of previous iterates used. Default 0.
+
+Example:
+\code
+chiLBSGroupsetSetAndersonAcceleration(phys1,cur_gs,5)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetAndersonAcceleration(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetAndersonAcceleration",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetAndersonAcceleration",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetAndersonAcceleration",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetAndersonAcceleration",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int depth        = lua_tonumber(L,3);
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetAndersonAcceleration: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetAndersonAcceleration";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetAndersonAcceleration";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Bounds checking
+  if (depth < 0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid Anderson depth specified "
+      << "in call to chiLBSGroupsetSetAndersonAcceleration. Must be >= 0.";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->anderson_depth = depth;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " Anderson acceleration depth set to "
+    << depth;
+
+  return 0;
+}
+
+//###################################################################
+/**Sets the number of source iterations between convergence checks of
+ * this groupset with NPT_CLASSICRICHARDSON. With an interval larger than
+ * 1 the convergence metrics are only computed every interval iterations
+ * and their global reduction overlaps the next sweep, hence convergence
+ * is detected one sweep late. The converged flux is unaffected.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param Interval int Iterations between checks. Default 1.
+
+Example:
+\code
+chiLBSGroupsetSetConvergenceCheckInterval(phys1,cur_gs,4)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetConvergenceCheckInterval(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetConvergenceCheckInterval",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetConvergenceCheckInterval",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetConvergenceCheckInterval",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetConvergenceCheckInterval",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  int interval     = lua_tonumber(L,3);
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetConvergenceCheckInterval: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetConvergenceCheckInterval";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetConvergenceCheckInterval";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Bounds checking
+  if (interval < 1)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid check interval specified "
+      << "in call to chiLBSGroupsetSetConvergenceCheckInterval. Must be >= 1.";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->convergence_check_interval = interval;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " convergence check interval set to "
+    << interval;
+
+  return 0;
+}
+
+//###################################################################
+/**Sets whether the fixed part of the source of this groupset, i.e. the
+ * material source and the scattering and fission from groups outside the
+ * groupset, is computed once per groupset solve and reused by every
+ * source iteration. The cache holds the source moments of the groupset
+ * groups and its size is reported at groupset initialization.
+
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param flag bool Flag enabling the cache. Default true.
+
+Example:
+\code
+chiLBSGroupsetSetFixedSourceCache(phys1,cur_gs,false)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetFixedSourceCache(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetFixedSourceCache",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetFixedSourceCache",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetFixedSourceCache",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetFixedSourceCache",L,3);
+  int  solver_index = lua_tonumber(L,1);
+  int  grpset_index = lua_tonumber(L,2);
+  bool flag         = lua_toboolean(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzmann::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    solver = dynamic_cast<LinearBoltzmann::Solver*>(psolver);
+
+    if (not solver)
+    {
+      chi_log.Log(LOG_ALLERROR) << "chiLBSGroupsetSetFixedSourceCache: Incorrect solver-type."
+                                   " Cannot cast to LinearBoltzmann::Solver\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetFixedSourceCache";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = &solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetFixedSourceCache";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->cache_fixed_source = flag;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index
+    << " fixed source cache set to "
+    << ((flag)? "true" : "false");
+
+  return 0;
+}
+
 //###################################################################
 /**Sets the Within-Group Diffusion Synthetic Acceleration parameters
  * for this groupset. If this call is being made then it is assumed
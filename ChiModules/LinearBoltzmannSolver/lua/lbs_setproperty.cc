@@ -32,6 +32,17 @@ extern ChiMath&     chi_math_handler;
 
 #define WRITE_RESTART_DATA 7
 
+#define SWEEP_MESSAGE_AGGREGATION 8
+
+#define SWEEP_STRUCTURE_CACHE 9
+
+#define SWEEP_PLAN 10
+
+#define ACROSS_GROUPSET_ITERATION 11
+  #define AGS_NONE         0
+  #define AGS_GAUSS_SEIDEL 1
+  #define AGS_JACOBI       2
+
 #include <chi_log.h>
 
 extern ChiLog& chi_log;
@@ -85,6 +96,57 @@ WRITE_RESTART_DATA\n
 chiLBSSetProperty(phys1,WRITE_RESTART_DATA,"YRestart1","restart",1)
 \endcode
 
+SWEEP_MESSAGE_AGGREGATION\n
+ Coalesces the sweep messages of all anglesets destined for the same
+ location into a single message per scheduling step. Expects to be followed
+ by the flush threshold in bytes; a pack is sent early once it exceeds
+ this size. A value of 0 disables aggregation. Default 0.
+ The number of messages and bytes sent per sweep are reported after each
+ groupset solve.\n\n
+
+\code
+chiLBSSetProperty(phys1,SWEEP_MESSAGE_AGGREGATION,256000)
+\endcode
+
+SWEEP_STRUCTURE_CACHE\n
+ Expects to be followed by a boolean. When true the sweep orderings (SPDS)
+ and flux data structures (FLUDS) are kept by the solver and shared by all
+ groupsets with the same directions and by later executions. They are
+ rebuilt when the solver is re-initialized or when the grid changes.
+ Setting this to false releases the cached structures, which are then
+ rebuilt for every groupset. Default true.\n\n
+
+\code
+chiLBSSetProperty(phys1,SWEEP_STRUCTURE_CACHE,false)
+\endcode
+
+SWEEP_PLAN\n
+ Enables per-location sweep-plan files holding the sweep orderings,
+ location dependencies and FLUDS mappings. When the files match the
+ current mesh and partitioning they are loaded instead of building the
+ sweep structures; otherwise the structures are built and written.
+ The value can be followed by two optional strings, the folder name and
+ the file base name. These are defaulted to "SweepPlans" and "plan"
+ respectively.\n\n
+
+\code
+chiLBSSetProperty(phys1,SWEEP_PLAN,"SweepPlans","plan")
+\endcode
+
+ACROSS_GROUPSET_ITERATION\n
+ Iterates over all groupsets until the across-groupset scattering and
+ fission sources have converged. Expects to be followed by a scheme,
+ AGS_NONE, AGS_GAUSS_SEIDEL or AGS_JACOBI, which can be followed by an
+ optional maximum number of iterations and an optional point-wise
+ tolerance. These are defaulted to 100 and 1.0e-6 respectively. With
+ AGS_NONE each groupset is solved once. Default AGS_NONE. AGS_JACOBI
+ lags the flux of all other groupsets but still solves the groupsets
+ one after another on all processes.\n\n
+
+\code
+chiLBSSetProperty(phys1,ACROSS_GROUPSET_ITERATION,AGS_GAUSS_SEIDEL,50,1.0e-6)
+\endcode
+
 ###Discretization methods
  PWLD2D = Piecewise Linear Finite Element 2D.\n
  PWLD3D = Piecewise Linear Finite Element 3D.
@@ -313,6 +375,99 @@ int chiLBSSetProperty(lua_State *L)
       solver->options.sweep_eager_limit = limit;
     }
   }
+  else if (property == SWEEP_MESSAGE_AGGREGATION)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_MESSAGE_AGGREGATION",
+                            3,numArgs);
+
+    int threshold = lua_tonumber(L,3);
+    if (threshold<0)
+    {
+      chi_log.Log(LOG_0ERROR)
+        << "Invalid flush threshold in call to "
+        << "chiLBSSetProperty:SWEEP_MESSAGE_AGGREGATION. "
+           "Value must be >= 0.";
+      exit(EXIT_FAILURE);
+    }
+
+    solver->options.sweep_aggregation_threshold = threshold;
+  }
+  else if (property == SWEEP_STRUCTURE_CACHE)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_STRUCTURE_CACHE",
+                            3,numArgs);
+
+    solver->sweep_cache.enabled = lua_toboolean(L,3);
+    if (not solver->sweep_cache.enabled)
+      solver->sweep_cache.Clear();
+
+    chi_log.Log(LOG_0) << "Sweep structure cache "
+                       << ((solver->sweep_cache.enabled)? "enabled" :
+                                                          "disabled");
+  }
+  else if (property == SWEEP_PLAN)
+  {
+    std::string folder   = "SweepPlans";
+    std::string filebase = "plan";
+    if (numArgs >= 3)
+      folder = std::string(lua_tostring(L,3));
+    if (numArgs >= 4)
+      filebase = std::string(lua_tostring(L,4));
+
+    solver->sweep_cache.SetPlanFile(folder, filebase);
+    chi_log.Log(LOG_0) << "Sweep plan files set to "
+                       << folder << "/" << filebase;
+  }
+  else if (property == ACROSS_GROUPSET_ITERATION)
+  {
+    if (numArgs < 3)
+      LuaPostArgAmountError("chiLBSSetProperty:ACROSS_GROUPSET_ITERATION",
+                            3,numArgs);
+
+    int scheme = lua_tonumber(L,3);
+    if      (scheme == AGS_NONE)
+      solver->options.ags_scheme = LinearBoltzmann::AGSScheme::NONE;
+    else if (scheme == AGS_GAUSS_SEIDEL)
+      solver->options.ags_scheme = LinearBoltzmann::AGSScheme::GAUSS_SEIDEL;
+    else if (scheme == AGS_JACOBI)
+      solver->options.ags_scheme = LinearBoltzmann::AGSScheme::JACOBI;
+    else
+    {
+      chi_log.Log(LOG_0ERROR)
+        << "Invalid scheme in call to "
+        << "chiLBSSetProperty:ACROSS_GROUPSET_ITERATION.";
+      exit(EXIT_FAILURE);
+    }
+
+    if (numArgs >= 4)
+    {
+      int max_iterations = lua_tonumber(L,4);
+      if (max_iterations < 1)
+      {
+        chi_log.Log(LOG_0ERROR)
+          << "Invalid maximum number of iterations in call to "
+          << "chiLBSSetProperty:ACROSS_GROUPSET_ITERATION. "
+             "Value must be > 0.";
+        exit(EXIT_FAILURE);
+      }
+      solver->options.ags_max_iterations = max_iterations;
+    }
+    if (numArgs >= 5)
+    {
+      double tolerance = lua_tonumber(L,5);
+      if (tolerance <= 0.0)
+      {
+        chi_log.Log(LOG_0ERROR)
+          << "Invalid tolerance in call to "
+          << "chiLBSSetProperty:ACROSS_GROUPSET_ITERATION. "
+             "Value must be > 0.0.";
+        exit(EXIT_FAILURE);
+      }
+      solver->options.ags_tolerance = tolerance;
+    }
+  }
   else if (property == READ_RESTART_DATA)
   {
     if (numArgs >= 3)
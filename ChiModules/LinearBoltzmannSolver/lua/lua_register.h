@@ -46,10 +46,18 @@ RegisterConstant(SCATTERING_ORDER,   4);
 RegisterConstant(SWEEP_EAGER_LIMIT,   5);
 RegisterConstant(READ_RESTART_DATA,   6);
 RegisterConstant(WRITE_RESTART_DATA,  7);
+RegisterConstant(SWEEP_MESSAGE_AGGREGATION,  8);
+RegisterConstant(SWEEP_STRUCTURE_CACHE,  9);
+RegisterConstant(SWEEP_PLAN,  10);
+RegisterConstant(ACROSS_GROUPSET_ITERATION,  11);
+RegisterConstant(AGS_NONE,          0);
+RegisterConstant(AGS_GAUSS_SEIDEL,  1);
+RegisterConstant(AGS_JACOBI,        2);
 RegisterFunction(chiLBSInitialize)
 RegisterFunction(chiLBSExecute)
 RegisterFunction(chiLBSGetFieldFunctionList)
 RegisterFunction(chiLBSGetScalarFieldFunctionList)
+RegisterFunction(chiLBSCellSolveBenchmark)
 
 //module:Linear Boltzmann Solver - Groupset manipulation
 //\ref LuaLBSGroupsets Main page
@@ -67,6 +75,23 @@ RegisterFunction(chiLBSGroupsetSetIterativeMethod)
 RegisterFunction(chiLBSGroupsetSetResidualTolerance)
 RegisterFunction(chiLBSGroupsetSetMaxIterations)
 RegisterFunction(chiLBSGroupsetSetGMRESRestartIntvl)
+RegisterFunction(chiLBSGroupsetSetKrylovType)
+AddNamedConstantToNamespace(KRYLOV_GMRES     ,1,LBSGroupset)
+AddNamedConstantToNamespace(KRYLOV_PGMRES    ,2,LBSGroupset)
+AddNamedConstantToNamespace(KRYLOV_PIPEFGMRES,3,LBSGroupset)
 RegisterFunction(chiLBSGroupsetSetEnableSweepLog)
+RegisterFunction(chiLBSGroupsetSetSweepNumThreads)
+RegisterFunction(chiLBSGroupsetSetSweepChunkType)
+AddNamedConstantToNamespace(SWEEP_CHUNK_PWLD              ,1,LBSGroupset)
+AddNamedConstantToNamespace(SWEEP_CHUNK_PWLD_GROUP_BATCHED,2,LBSGroupset)
+RegisterFunction(chiLBSGroupsetSetCellMatrixCache)
+RegisterFunction(chiLBSGroupsetSetSweepScheduler)
+AddNamedConstantToNamespace(SWEEP_SCHEDULER_FIFO          ,1,LBSGroupset)
+AddNamedConstantToNamespace(SWEEP_SCHEDULER_DEPTH_OF_GRAPH,2,LBSGroupset)
+AddNamedConstantToNamespace(SWEEP_SCHEDULER_CRITICAL_PATH ,3,LBSGroupset)
+RegisterFunction(chiLBSGroupsetSetFLUDSReorderTies)
+RegisterFunction(chiLBSGroupsetSetAndersonAcceleration)
+RegisterFunction(chiLBSGroupsetSetConvergenceCheckInterval)
+RegisterFunction(chiLBSGroupsetSetFixedSourceCache)
 RegisterFunction(chiLBSGroupsetSetWGDSA)
 RegisterFunction(chiLBSGroupsetSetTGDSA)
\ No newline at end of file
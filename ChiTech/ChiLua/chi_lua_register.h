@@ -49,6 +49,8 @@ RegisterFunction(chiMeshCreateUnpartitioned3DOrthoMesh)
 
 RegisterFunction(chiUnpartitionedMeshFromVTU)
 RegisterFunction(chiUnpartitionedMeshFromEnsightGold)
+  RegisterConstant(ALL_FROM_HOME, 0);
+  RegisterConstant(DIVIDE_WORK,   1);
 
 
 //module:Mesh Utilities
@@ -77,6 +79,8 @@ RegisterFunction(chiEdgeLoopSplitByAngle)
     RegisterFunction(chiRegionExportMeshToPython)
     RegisterFunction(chiRegionExportMeshToObj)
     RegisterFunction(chiRegionExportMeshToVTK)
+    RegisterFunction(chiRegionExportMeshToCheckpoint)
+    RegisterFunction(chiMeshReadCheckpoint)
 //  SurfaceMesh
     RegisterFunction(chiSurfaceMeshCreate)
     RegisterFunction(chiSurfaceMeshCreateFromArrays)
@@ -116,6 +120,7 @@ RegisterFunction(chiEdgeLoopSplitByAngle)
       RegisterConstant(VOLUMEMESHER_PREDEFINED2D, 3);
       RegisterConstant(VOLUMEMESHER_EXTRUDER,     4);
       RegisterConstant(VOLUMEMESHER_PREDEFINED3D, 5)
+      RegisterConstant(VOLUMEMESHER_UNPARTITIONED, 6)
     RegisterFunction(chiVolumeMesherExecute)
     RegisterFunction(chiVolumeMesherSetProperty)
       RegisterConstant(FORCE_POLYGONS,   1);
@@ -133,6 +138,7 @@ RegisterFunction(chiEdgeLoopSplitByAngle)
       RegisterConstant(EXTRUSION_LAYER,   10);
       RegisterConstant(MATID_FROMLOGICAL,   11);
       RegisterConstant(BNDRYID_FROMLOGICAL, 12);
+      RegisterConstant(CONNECTIVITY_THREADS, 13);
 //  Domain Decomposition
     RegisterFunction(chiDomDecompose2D)
     RegisterFunction(chiDecomposeSurfaceMeshPxPy)
@@ -41,8 +41,7 @@ BuildSparsityPattern(chi_mesh::MeshContinuumPtr grid,
     {
       if (face.has_neighbor and face.IsNeighborLocal(*grid))
       {
-        auto& adj_cell = grid->cells[face.neighbor_id];
-        auto adj_cell_fe_view = GetCellMappingFE(adj_cell.local_id);
+        auto adj_cell_fe_view = GetCellMappingFE(face.GetNeighborLocalID(*grid));
 
         for (int i=0; i<num_nodes; ++i)
         {
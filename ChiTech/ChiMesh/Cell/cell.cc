@@ -8,12 +8,16 @@ extern ChiLog& chi_log;
 extern ChiMPI& chi_mpi;
 
 //###################################################################
-/**Determines the neighbor's partition and whether its local or not.*/
+/**Determines the neighbor's partition and whether its local or not.
+ * Uses the indices stored by MeshContinuum::EstablishNeighborIndices
+ * when available.*/
 bool chi_mesh::CellFace::
   IsNeighborLocal(chi_mesh::MeshContinuum& grid) const
 {
   if (not has_neighbor) return false;
   if (chi_mpi.process_count == 1) return true;
+  if (neighbor_partition_id >= 0)
+    return (neighbor_partition_id == chi_mpi.location_id);
 
   auto& adj_cell = grid.cells[neighbor_id];
 
@@ -27,6 +31,7 @@ int chi_mesh::CellFace::
 {
   if (not has_neighbor) return -1;
   if (chi_mpi.process_count == 1) return 0;
+  if (neighbor_partition_id >= 0) return neighbor_partition_id;
 
   auto& adj_cell = grid.cells[neighbor_id];
 
@@ -40,6 +45,7 @@ int chi_mesh::CellFace::
 {
   if (not has_neighbor) return -1;
   if (chi_mpi.process_count == 1) return neighbor_id; //cause global_ids=local_ids
+  if (neighbor_local_id >= 0) return static_cast<int>(neighbor_local_id);
 
   auto& adj_cell = grid.cells[neighbor_id];
 
@@ -33,6 +33,8 @@ public:
   Vertex centroid;                  ///< The face centroid
   bool has_neighbor=false;          ///< Flag indicating whether face has a neighbor
   uint64_t neighbor_id=0;           ///< If face has neighbor, contains the global id. 0 otherwise.
+  int64_t neighbor_local_id=-1;     ///< Precomputed neighbor local id, -1 if not local.
+  int neighbor_partition_id=-1;     ///< Precomputed neighbor partition, -1 if not established.
 
 public:
   bool IsNeighborLocal(chi_mesh::MeshContinuum& grid) const;
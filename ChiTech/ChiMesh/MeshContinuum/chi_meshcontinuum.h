@@ -4,9 +4,12 @@
 #include "../chi_mesh.h"
 #include "chi_meshcontinuum_localcellhandler.h"
 #include "chi_meshcontinuum_globalcellhandler.h"
+#include "chi_meshcontinuum_packedview.h"
 
 #include "chi_mpi.h"
 
+#include <map>
+
 
 
 
@@ -19,8 +22,8 @@ private:
   std::vector<chi_mesh::Cell*> native_cells;  ///< Actual native cells
   std::vector<chi_mesh::Cell*> foreign_cells; ///< Locally stored ghosts
 
-  std::map<uint64_t,uint64_t> global_cell_id_to_native_id_map;
-  std::map<uint64_t,uint64_t> global_cell_id_to_foreign_id_map;
+  GlobalIDMap global_cell_id_to_native_id_map;
+  GlobalIDMap global_cell_id_to_foreign_id_map;
 
 
 public:
@@ -42,6 +45,8 @@ private:
 
   ChiMPICommunicatorSet commicator_set;
 
+  std::unique_ptr<PackedMeshView> packed_view;
+
 public:
   MeshContinuum() :
     local_cells(native_cells, foreign_cells),
@@ -67,6 +72,7 @@ public:
     foreign_cells.clear();
     global_cell_id_to_native_id_map.clear();
     global_cell_id_to_foreign_id_map.clear();
+    packed_view.reset();
   }
 
   //01
@@ -86,6 +92,7 @@ public:
   size_t GetFaceHistogramBinDOFSize(size_t category);
   bool IsCellLocal(uint64_t cell_global_index);
   bool IsCellBndry(uint64_t cell_global_index);
+  void EstablishNeighborIndices();
 
   void FindAssociatedVertices(chi_mesh::CellFace& cur_face,
                               std::vector<short>& dof_mapping);
@@ -98,6 +105,33 @@ public:
   ChiMPICommunicatorSet& GetCommunicator();
 
   size_t GetGlobalNumberOfCells();
+
+  const PackedMeshView& GetPackedView();
+  /**Discards the packed view. Must be called by everything that changes
+   * the local cells after meshing so that the view is rebuilt.*/
+  void InvalidatePackedView() {packed_view.reset();}
+
+  //03
+  struct CheckpointInfo
+  {
+    int      process_count = 0;
+    uint64_t num_global_cells = 0;
+  };
+  void WriteCheckpoint(const std::string& folder_name,
+                       const std::string& file_base);
+  void ReadCheckpoint(const std::string& folder_name,
+                      const std::string& file_base);
+  static CheckpointInfo
+    ReadCheckpointInfo(const std::string& folder_name,
+                       const std::string& file_base);
+  static void
+    ReadCheckpointVertices(const std::string& folder_name,
+                           const std::string& file_base,
+                           std::vector<chi_mesh::Vertex*>& vertices);
+  static std::vector<chi_mesh::Cell*>
+    ReadCheckpointCells(const std::string& folder_name,
+                        const std::string& file_base,
+                        int file_location);
 };
 
 #endif //CHI_MESHCONTINUUM_H_
\ No newline at end of file
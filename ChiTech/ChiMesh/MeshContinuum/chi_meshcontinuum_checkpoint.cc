@@ -0,0 +1,452 @@
+#include "chi_meshcontinuum.h"
+
+#include "ChiMesh/Cell/cell_slab.h"
+#include "ChiMesh/Cell/cell_polygon.h"
+#include "ChiMesh/Cell/cell_polyhedron.h"
+#include "ChiMesh/SweepUtilities/SweepPlan/sweep_plan_io.h"
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+#include <sys/stat.h>
+#include <cerrno>
+#include <fstream>
+#include <algorithm>
+
+namespace
+{
+  const uint64_t MESH_CHECKPOINT_MAGIC   = 0x4b4843484d494843; //"CHIMHCHK"
+  const uint32_t MESH_CHECKPOINT_VERSION = 1;
+
+  std::string VerticesFileName(const std::string& folder_name,
+                               const std::string& file_base)
+  {
+    return folder_name + "/" + file_base + "_vertices.cmc";
+  }
+
+  std::string CellsFileName(const std::string& folder_name,
+                            const std::string& file_base,
+                            int location)
+  {
+    return folder_name + "/" + file_base + std::to_string(location) + ".cmc";
+  }
+}
+
+//###################################################################
+/**Writes the grid to binary checkpoint files in folder_name.
+ *
+ * Location 0 writes the vertices, which every location holds in full,
+ * to <file_base>_vertices.cmc. Every location writes its local cells,
+ * followed by its ghost cells, to <file_base><location_id>.cmc. Cells
+ * are stored as flat arrays (types, ids, centroids, vertex ids and
+ * per-face neighbors, normals, centroids and vertex ids) so that every
+ * array is a single contiguous write. Values are stored in native byte
+ * order.*/
+void chi_mesh::MeshContinuum::
+  WriteCheckpoint(const std::string& folder_name,
+                  const std::string& file_base)
+{
+  using namespace chi_mesh::sweep_management::plan_io;
+
+  //============================================= Create folder
+  struct stat st = {0};
+  if (chi_mpi.location_id == 0)
+  {
+    if (stat(folder_name.c_str(),&st) != 0) //if not exist, make it
+      if ( (mkdir(folder_name.c_str(),S_IRWXU | S_IRWXG | S_IRWXO) != 0) and
+           (errno != EEXIST) )
+      {
+        chi_log.Log(LOG_ALLERROR)
+          << "Failed to create mesh checkpoint directory: " << folder_name;
+        exit(EXIT_FAILURE);
+      }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  const uint64_t num_global_cells = GetGlobalNumberOfCells();
+
+  //============================================= Vertices
+  if (chi_mpi.location_id == 0)
+  {
+    std::vector<double> xyz;
+    xyz.reserve(3*vertices.size());
+    for (auto vertex : vertices)
+    {
+      xyz.push_back(vertex->x);
+      xyz.push_back(vertex->y);
+      xyz.push_back(vertex->z);
+    }
+
+    std::ofstream file(VerticesFileName(folder_name, file_base),
+                       std::ios::out | std::ios::binary);
+    Write(file, MESH_CHECKPOINT_MAGIC);
+    Write(file, MESH_CHECKPOINT_VERSION);
+    Write(file, chi_mpi.process_count);
+    Write(file, num_global_cells);
+    WriteVector(file, xyz);
+
+    if (not file.good())
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Failed to write mesh checkpoint "
+        << VerticesFileName(folder_name, file_base);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  //============================================= Flatten cells
+  std::vector<chi_mesh::Cell*> all_cells;
+  all_cells.reserve(native_cells.size() + foreign_cells.size());
+  all_cells.insert(all_cells.end(), native_cells.begin(), native_cells.end());
+  all_cells.insert(all_cells.end(), foreign_cells.begin(),foreign_cells.end());
+
+  std::vector<int>      cell_types;
+  std::vector<uint64_t> cell_global_ids;
+  std::vector<uint64_t> cell_partition_ids;
+  std::vector<int>      cell_material_ids;
+  std::vector<double>   cell_centroids;
+  std::vector<uint64_t> cell_vertex_offsets(1,0);
+  std::vector<uint64_t> cell_vertex_ids;
+  std::vector<uint64_t> cell_face_offsets(1,0);
+
+  std::vector<char>     face_has_neighbor;
+  std::vector<uint64_t> face_neighbor_ids;
+  std::vector<double>   face_normals;
+  std::vector<double>   face_centroids;
+  std::vector<uint64_t> face_vertex_offsets(1,0);
+  std::vector<uint64_t> face_vertex_ids;
+
+  const size_t num_cells = all_cells.size();
+  cell_types.reserve(num_cells);
+  cell_global_ids.reserve(num_cells);
+  cell_partition_ids.reserve(num_cells);
+  cell_material_ids.reserve(num_cells);
+  cell_centroids.reserve(3*num_cells);
+
+  for (auto cell : all_cells)
+  {
+    cell_types.push_back(static_cast<int>(cell->Type()));
+    cell_global_ids.push_back(cell->global_id);
+    cell_partition_ids.push_back(cell->partition_id);
+    cell_material_ids.push_back(cell->material_id);
+    cell_centroids.push_back(cell->centroid.x);
+    cell_centroids.push_back(cell->centroid.y);
+    cell_centroids.push_back(cell->centroid.z);
+
+    cell_vertex_ids.insert(cell_vertex_ids.end(),
+                           cell->vertex_ids.begin(), cell->vertex_ids.end());
+    cell_vertex_offsets.push_back(cell_vertex_ids.size());
+
+    for (const auto& face : cell->faces)
+    {
+      face_has_neighbor.push_back(face.has_neighbor? 1 : 0);
+      face_neighbor_ids.push_back(face.neighbor_id);
+      face_normals.push_back(face.normal.x);
+      face_normals.push_back(face.normal.y);
+      face_normals.push_back(face.normal.z);
+      face_centroids.push_back(face.centroid.x);
+      face_centroids.push_back(face.centroid.y);
+      face_centroids.push_back(face.centroid.z);
+
+      face_vertex_ids.insert(face_vertex_ids.end(),
+                             face.vertex_ids.begin(), face.vertex_ids.end());
+      face_vertex_offsets.push_back(face_vertex_ids.size());
+    }
+    cell_face_offsets.push_back(face_has_neighbor.size());
+  }
+
+  //============================================= Write cells
+  const std::string file_name =
+    CellsFileName(folder_name, file_base, chi_mpi.location_id);
+  std::ofstream file(file_name, std::ios::out | std::ios::binary);
+
+  Write(file, MESH_CHECKPOINT_MAGIC);
+  Write(file, MESH_CHECKPOINT_VERSION);
+  Write(file, chi_mpi.process_count);
+  Write(file, chi_mpi.location_id);
+  Write(file, static_cast<uint64_t>(native_cells.size()));
+
+  WriteVector(file, cell_types);
+  WriteVector(file, cell_global_ids);
+  WriteVector(file, cell_partition_ids);
+  WriteVector(file, cell_material_ids);
+  WriteVector(file, cell_centroids);
+  WriteVector(file, cell_vertex_offsets);
+  WriteVector(file, cell_vertex_ids);
+  WriteVector(file, cell_face_offsets);
+
+  WriteVector(file, face_has_neighbor);
+  WriteVector(file, face_neighbor_ids);
+  WriteVector(file, face_normals);
+  WriteVector(file, face_centroids);
+  WriteVector(file, face_vertex_offsets);
+  WriteVector(file, face_vertex_ids);
+
+  if (not file.good())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Failed to write mesh checkpoint " << file_name;
+    exit(EXIT_FAILURE);
+  }
+  file.close();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  chi_log.Log(LOG_0) << "Mesh checkpoint written to "
+                     << folder_name << "/" << file_base;
+}
+
+//###################################################################
+/**Reads the process count and global number of cells with which a
+ * checkpoint was written. Collective, location 0 reads the vertex file
+ * header.*/
+chi_mesh::MeshContinuum::CheckpointInfo chi_mesh::MeshContinuum::
+  ReadCheckpointInfo(const std::string& folder_name,
+                     const std::string& file_base)
+{
+  using namespace chi_mesh::sweep_management::plan_io;
+
+  CheckpointInfo info;
+  if (chi_mpi.location_id == 0)
+  {
+    std::ifstream file(VerticesFileName(folder_name, file_base),
+                       std::ios::in | std::ios::binary);
+    uint64_t magic = 0;
+    uint32_t version = 0;
+    Read(file, magic);
+    Read(file, version);
+    Read(file, info.process_count);
+    Read(file, info.num_global_cells);
+
+    if ((not file.good()) or (magic != MESH_CHECKPOINT_MAGIC) or
+        (version != MESH_CHECKPOINT_VERSION))
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Invalid mesh checkpoint "
+        << VerticesFileName(folder_name, file_base);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  MPI_Bcast(&info.process_count,1,MPI_INT,0,MPI_COMM_WORLD);
+  MPI_Bcast(&info.num_global_cells,1,MPI_UNSIGNED_LONG_LONG,0,MPI_COMM_WORLD);
+
+  return info;
+}
+
+//###################################################################
+/**Reads the checkpoint vertices on location 0 and broadcasts them to
+ * all locations.*/
+void chi_mesh::MeshContinuum::
+  ReadCheckpointVertices(const std::string& folder_name,
+                         const std::string& file_base,
+                         std::vector<chi_mesh::Vertex*>& vertices)
+{
+  using namespace chi_mesh::sweep_management::plan_io;
+
+  std::vector<double> xyz;
+  uint64_t num_values = 0;
+  if (chi_mpi.location_id == 0)
+  {
+    std::ifstream file(VerticesFileName(folder_name, file_base),
+                       std::ios::in | std::ios::binary);
+    uint64_t magic = 0;
+    uint32_t version = 0;
+    int      process_count = 0;
+    uint64_t num_global_cells = 0;
+    Read(file, magic);
+    Read(file, version);
+    Read(file, process_count);
+    Read(file, num_global_cells);
+    ReadVector(file, xyz);
+
+    if (not file.good())
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Failed to read mesh checkpoint "
+        << VerticesFileName(folder_name, file_base);
+      exit(EXIT_FAILURE);
+    }
+    num_values = xyz.size();
+  }
+
+  MPI_Bcast(&num_values,1,MPI_UNSIGNED_LONG_LONG,0,MPI_COMM_WORLD);
+  xyz.resize(num_values);
+
+  //Broadcast in chunks to stay within int counts
+  const uint64_t chunk_size = uint64_t(1) << 28;
+  for (uint64_t start=0; start<num_values; start += chunk_size)
+  {
+    int count = static_cast<int>(std::min(chunk_size, num_values - start));
+    MPI_Bcast(xyz.data() + start,count,MPI_DOUBLE,0,MPI_COMM_WORLD);
+  }
+
+  vertices.reserve(vertices.size() + num_values/3);
+  for (uint64_t v=0; v<num_values; v += 3)
+    vertices.push_back(new chi_mesh::Vertex(xyz[v],xyz[v+1],xyz[v+2]));
+}
+
+//###################################################################
+/**Reads all the cells, local and ghost, written by location
+ * file_location. The caller owns the returned cells.*/
+std::vector<chi_mesh::Cell*> chi_mesh::MeshContinuum::
+  ReadCheckpointCells(const std::string& folder_name,
+                      const std::string& file_base,
+                      int file_location)
+{
+  using namespace chi_mesh::sweep_management::plan_io;
+
+  const std::string file_name =
+    CellsFileName(folder_name, file_base, file_location);
+  std::ifstream file(file_name, std::ios::in | std::ios::binary);
+
+  if (not file.is_open())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Failed to open mesh checkpoint " << file_name;
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Header
+  uint64_t magic = 0;
+  uint32_t version = 0;
+  int      process_count = 0;
+  int      location_id = 0;
+  uint64_t num_native_cells = 0;
+  Read(file, magic);
+  Read(file, version);
+  Read(file, process_count);
+  Read(file, location_id);
+  Read(file, num_native_cells);
+
+  if ((magic != MESH_CHECKPOINT_MAGIC) or
+      (version != MESH_CHECKPOINT_VERSION) or
+      (location_id != file_location))
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid mesh checkpoint " << file_name;
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Arrays
+  std::vector<int>      cell_types;
+  std::vector<uint64_t> cell_global_ids;
+  std::vector<uint64_t> cell_partition_ids;
+  std::vector<int>      cell_material_ids;
+  std::vector<double>   cell_centroids;
+  std::vector<uint64_t> cell_vertex_offsets;
+  std::vector<uint64_t> cell_vertex_ids;
+  std::vector<uint64_t> cell_face_offsets;
+
+  std::vector<char>     face_has_neighbor;
+  std::vector<uint64_t> face_neighbor_ids;
+  std::vector<double>   face_normals;
+  std::vector<double>   face_centroids;
+  std::vector<uint64_t> face_vertex_offsets;
+  std::vector<uint64_t> face_vertex_ids;
+
+  ReadVector(file, cell_types);
+  ReadVector(file, cell_global_ids);
+  ReadVector(file, cell_partition_ids);
+  ReadVector(file, cell_material_ids);
+  ReadVector(file, cell_centroids);
+  ReadVector(file, cell_vertex_offsets);
+  ReadVector(file, cell_vertex_ids);
+  ReadVector(file, cell_face_offsets);
+
+  ReadVector(file, face_has_neighbor);
+  ReadVector(file, face_neighbor_ids);
+  ReadVector(file, face_normals);
+  ReadVector(file, face_centroids);
+  ReadVector(file, face_vertex_offsets);
+  ReadVector(file, face_vertex_ids);
+
+  if (not file.good())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Failed to read mesh checkpoint " << file_name;
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Build cells
+  const size_t num_cells = cell_types.size();
+  std::vector<chi_mesh::Cell*> cells_read;
+  cells_read.reserve(num_cells);
+  for (size_t c=0; c<num_cells; ++c)
+  {
+    chi_mesh::Cell* cell;
+    auto cell_type = static_cast<chi_mesh::CellType>(cell_types[c]);
+    if (cell_type == chi_mesh::CellType::SLAB)
+      cell = new chi_mesh::CellSlab;
+    else if (cell_type == chi_mesh::CellType::POLYGON)
+      cell = new chi_mesh::CellPolygon;
+    else if (cell_type == chi_mesh::CellType::POLYHEDRON)
+      cell = new chi_mesh::CellPolyhedron;
+    else
+      cell = new chi_mesh::Cell(cell_type);
+
+    cell->global_id    = cell_global_ids[c];
+    cell->partition_id = cell_partition_ids[c];
+    cell->material_id  = cell_material_ids[c];
+    cell->centroid = chi_mesh::Vertex(cell_centroids[3*c+0],
+                                      cell_centroids[3*c+1],
+                                      cell_centroids[3*c+2]);
+
+    cell->vertex_ids.assign(cell_vertex_ids.begin() + cell_vertex_offsets[c],
+                            cell_vertex_ids.begin() + cell_vertex_offsets[c+1]);
+
+    cell->faces.resize(cell_face_offsets[c+1] - cell_face_offsets[c]);
+    uint64_t f = cell_face_offsets[c];
+    for (auto& face : cell->faces)
+    {
+      face.has_neighbor = (face_has_neighbor[f] == 1);
+      face.neighbor_id  = face_neighbor_ids[f];
+      face.normal   = chi_mesh::Normal(face_normals[3*f+0],
+                                       face_normals[3*f+1],
+                                       face_normals[3*f+2]);
+      face.centroid = chi_mesh::Vertex(face_centroids[3*f+0],
+                                       face_centroids[3*f+1],
+                                       face_centroids[3*f+2]);
+      face.vertex_ids.assign(face_vertex_ids.begin() + face_vertex_offsets[f],
+                             face_vertex_ids.begin() + face_vertex_offsets[f+1]);
+      ++f;
+    }
+
+    cells_read.push_back(cell);
+  }
+
+  return cells_read;
+}
+
+//###################################################################
+/**Loads the grid from checkpoint files written by WriteCheckpoint with
+ * the same process count. Local cells keep their local ids.*/
+void chi_mesh::MeshContinuum::
+  ReadCheckpoint(const std::string& folder_name,
+                 const std::string& file_base)
+{
+  auto info = ReadCheckpointInfo(folder_name, file_base);
+  if (info.process_count != chi_mpi.process_count)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Mesh checkpoint " << folder_name << "/" << file_base
+      << " was written with " << info.process_count
+      << " processes and cannot be read directly with "
+      << chi_mpi.process_count << ".";
+    exit(EXIT_FAILURE);
+  }
+
+  ReadCheckpointVertices(folder_name, file_base, vertices);
+
+  for (auto cell : ReadCheckpointCells(folder_name, file_base,
+                                       chi_mpi.location_id))
+    cells.push_back(cell);
+
+  const size_t num_global_cells = GetGlobalNumberOfCells();
+  chi_log.Log(LOG_0) << "Mesh checkpoint read from "
+                     << folder_name << "/" << file_base
+                     << ". Cells read = " << num_global_cells;
+}
@@ -36,7 +36,7 @@ void chi_mesh::MeshContinuum::CommunicatePartitionNeighborCells(
       if (face.has_neighbor and (not face.IsNeighborLocal(*this)))
       {
         local_neighboring_cell_indices.insert(cell.local_id);
-        neighboring_partitions.insert(cells[face.neighbor_id].partition_id);
+        neighboring_partitions.insert(face.GetNeighborPartitionID(*this));
       }
     }
   }
@@ -63,7 +63,7 @@ void chi_mesh::MeshContinuum::CommunicatePartitionNeighborCells(
 
       for (auto& face : cell.faces)
         if ((face.has_neighbor) and (not face.IsNeighborLocal(*this)) )
-          if (cells[face.neighbor_id].partition_id == adj_part)
+          if (face.GetNeighborPartitionID(*this) == adj_part)
             new_list.second.push_back(local_cell_index);
 
     }//for neighbor cells
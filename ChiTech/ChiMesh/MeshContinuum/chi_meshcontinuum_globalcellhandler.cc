@@ -11,6 +11,13 @@ extern ChiLog& chi_log;
 void chi_mesh::GlobalCellHandler::
   push_back(chi_mesh::Cell *new_cell)
 {
+  //Neighbor indices are only valid within the grid that established them
+  for (auto& face : new_cell->faces)
+  {
+    face.neighbor_local_id = -1;
+    face.neighbor_partition_id = -1;
+  }
+
   if (new_cell->partition_id == chi_mpi.location_id)
   {
     local_cell_glob_indices.push_back(new_cell->global_id);
@@ -19,15 +26,15 @@ void chi_mesh::GlobalCellHandler::
 
     native_cells.push_back(new_cell);
 
-    global_cell_id_to_native_id_map.insert(std::make_pair(
-      new_cell->global_id, native_cells.size()-1));
+    global_cell_id_to_native_id_map.Insert(new_cell->global_id,
+                                           native_cells.size() - 1);
   }
   else
   {
     foreign_cells.push_back(new_cell);
 
-    global_cell_id_to_foreign_id_map.insert(std::make_pair(
-      new_cell->global_id, foreign_cells.size() - 1));
+    global_cell_id_to_foreign_id_map.Insert(new_cell->global_id,
+                                            foreign_cells.size() - 1);
   }
 
 }
@@ -37,16 +44,11 @@ void chi_mesh::GlobalCellHandler::
 chi_mesh::Cell& chi_mesh::GlobalCellHandler::
   operator[](uint64_t cell_global_index)
 {
-  auto native_location = global_cell_id_to_native_id_map.find(cell_global_index);
-
-  if (native_location != global_cell_id_to_native_id_map.end())
-    return *native_cells[native_location->second];
-  else
-  {
-    auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map.end())
-      return *foreign_cells[foreign_location->second];
-  }
+  uint64_t index;
+  if (global_cell_id_to_native_id_map.Find(cell_global_index, index))
+    return *native_cells[index];
+  if (global_cell_id_to_foreign_id_map.Find(cell_global_index, index))
+    return *foreign_cells[index];
 
   std::stringstream ostr;
   ostr << "chi_mesh::MeshContinuum::cells. Mapping error."
@@ -97,10 +99,9 @@ std::vector<uint64_t> chi_mesh::GlobalCellHandler::
 uint64_t chi_mesh::GlobalCellHandler::
   GetGhostLocalID(int cell_global_index)
 {
-  auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-
-  if (foreign_location != global_cell_id_to_foreign_id_map.end())
-    return foreign_location->second;
+  uint64_t index;
+  if (global_cell_id_to_foreign_id_map.Find(cell_global_index, index))
+    return index;
 
   std::stringstream ostr;
   ostr << "Grid GetGhostLocalID failed to find cell " << cell_global_index;
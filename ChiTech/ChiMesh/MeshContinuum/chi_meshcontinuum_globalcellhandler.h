@@ -2,8 +2,7 @@
 #define CHI_MESHCONTINUUM_GLOBALCELLHANDLER_H_
 
 #include "ChiMesh/Cell/cell.h"
-
-#include <map>
+#include "chi_meshcontinuum_globalidmap.h"
 
 namespace chi_mesh
 {
@@ -18,8 +17,8 @@ private:
   std::vector<chi_mesh::Cell*>& native_cells;
   std::vector<chi_mesh::Cell*>& foreign_cells;
 
-  std::map<uint64_t,uint64_t>& global_cell_id_to_native_id_map;
-  std::map<uint64_t,uint64_t>& global_cell_id_to_foreign_id_map;
+  GlobalIDMap& global_cell_id_to_native_id_map;
+  GlobalIDMap& global_cell_id_to_foreign_id_map;
 
 
 private:
@@ -27,8 +26,8 @@ private:
     std::vector<uint64_t>& in_local_cell_glob_indices,
     std::vector<chi_mesh::Cell*>& in_native_cells,
     std::vector<chi_mesh::Cell*>& in_foreign_cells,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_native_id_map,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_foreign_id_map) :
+    GlobalIDMap& in_global_cell_id_to_native_id_map,
+    GlobalIDMap& in_global_cell_id_to_foreign_id_map) :
     local_cell_glob_indices(in_local_cell_glob_indices),
     native_cells(in_native_cells),
     foreign_cells(in_foreign_cells),
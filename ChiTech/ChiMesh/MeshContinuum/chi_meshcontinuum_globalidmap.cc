@@ -0,0 +1,89 @@
+#include "chi_meshcontinuum_globalidmap.h"
+
+constexpr uint64_t chi_mesh::GlobalIDMap::EMPTY;
+
+//###################################################################
+/**Adds a global id with its storage index.*/
+void chi_mesh::GlobalIDMap::Insert(uint64_t global_id, uint64_t index)
+{
+  if (dense)
+  {
+    if (num_entries == 0 and index == 0)
+    {
+      dense_first_id = global_id;
+      num_entries = 1;
+      return;
+    }
+    if (global_id - dense_first_id < num_entries) return;
+    if ((global_id == dense_first_id + num_entries) and (index == num_entries))
+    {
+      ++num_entries;
+      return;
+    }
+
+    //=================================== Leave dense mode
+    const size_t num_dense = num_entries;
+    dense = false;
+    num_entries = 0;
+    Rehash(2*(num_dense + 1));
+    for (uint64_t i=0; i<num_dense; ++i)
+      InsertHashed(dense_first_id + i, i);
+  }
+
+  InsertHashed(global_id, index);
+}
+
+//###################################################################
+/**Removes all entries.*/
+void chi_mesh::GlobalIDMap::clear()
+{
+  dense = true;
+  dense_first_id = 0;
+  num_entries = 0;
+  keys = std::vector<uint64_t>();
+  values = std::vector<uint64_t>();
+  mask = 0;
+}
+
+//###################################################################
+/**Inserts into the hash table, keeping the load factor at or below
+ * one half.*/
+void chi_mesh::GlobalIDMap::InsertHashed(uint64_t global_id, uint64_t index)
+{
+  if (2*(num_entries + 1) > keys.size())
+    Rehash(2*(num_entries + 1));
+
+  uint64_t slot = Hash(global_id) & mask;
+  while (keys[slot] != EMPTY)
+  {
+    if (keys[slot] == global_id) return;
+    slot = (slot + 1) & mask;
+  }
+  keys[slot] = global_id;
+  values[slot] = index;
+  ++num_entries;
+}
+
+//###################################################################
+/**Grows the table to the next power of two of at least the given
+ * capacity and reinserts all entries.*/
+void chi_mesh::GlobalIDMap::Rehash(size_t capacity)
+{
+  size_t new_capacity = 16;
+  while (new_capacity < capacity) new_capacity <<= 1;
+
+  std::vector<uint64_t> old_keys(new_capacity, EMPTY);
+  std::vector<uint64_t> old_values(new_capacity, 0);
+  old_keys.swap(keys);
+  old_values.swap(values);
+  mask = new_capacity - 1;
+
+  for (size_t s=0; s<old_keys.size(); ++s)
+  {
+    if (old_keys[s] == EMPTY) continue;
+    uint64_t slot = Hash(old_keys[s]) & mask;
+    while (keys[slot] != EMPTY) slot = (slot + 1) & mask;
+    keys[slot] = old_keys[s];
+    values[slot] = old_values[s];
+  }
+}
@@ -0,0 +1,77 @@
+#ifndef CHI_MESHCONTINUUM_GLOBALIDMAP_H_
+#define CHI_MESHCONTINUUM_GLOBALIDMAP_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Maps cell global ids to storage indices.
+ *
+ * While global ids are inserted as a contiguous run with indices
+ * 0,1,2,... the map stores nothing but the first id and a lookup is a
+ * subtraction. Any other insertion moves the map to a flat
+ * open-addressing hash table with linear probing. Inserting an existing
+ * id does nothing, as for std::map::insert.*/
+class GlobalIDMap
+{
+private:
+  static constexpr uint64_t EMPTY = ~uint64_t(0);
+
+  bool     dense = true;
+  uint64_t dense_first_id = 0;
+  size_t   num_entries = 0;
+
+  std::vector<uint64_t> keys;
+  std::vector<uint64_t> values;
+  uint64_t              mask = 0;
+
+public:
+  void Insert(uint64_t global_id, uint64_t index);
+
+  /**Finds a global id. Returns false if the id is not present.*/
+  bool Find(uint64_t global_id, uint64_t& index) const
+  {
+    if (dense)
+    {
+      const uint64_t i = global_id - dense_first_id;
+      if (i < num_entries) {index = i; return true;}
+      return false;
+    }
+
+    uint64_t slot = Hash(global_id) & mask;
+    while (keys[slot] != EMPTY)
+    {
+      if (keys[slot] == global_id) {index = values[slot]; return true;}
+      slot = (slot + 1) & mask;
+    }
+    return false;
+  }
+
+  bool Contains(uint64_t global_id) const
+  {uint64_t index; return Find(global_id, index);}
+
+  size_t size() const {return num_entries;}
+  bool   IsDense() const {return dense;}
+  void   clear();
+
+private:
+  /**splitmix64 finalizer.*/
+  static uint64_t Hash(uint64_t key)
+  {
+    uint64_t z = key + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  void InsertHashed(uint64_t global_id, uint64_t index);
+  void Rehash(size_t capacity);
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_GLOBALIDMAP_H_
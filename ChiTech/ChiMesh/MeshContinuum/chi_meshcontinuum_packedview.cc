@@ -0,0 +1,119 @@
+#include "chi_meshcontinuum_packedview.h"
+#include "chi_meshcontinuum.h"
+
+#include "chi_log.h"
+
+extern ChiLog& chi_log;
+
+#include <iomanip>
+
+//###################################################################
+/**Packs the local cells, their faces and the vertices of a grid.
+ * Neighbor partitions and local ids are established on the grid first,
+ * so that loops over the view never look up a global cell id.*/
+void chi_mesh::PackedMeshView::Build(chi_mesh::MeshContinuum& grid)
+{
+  grid.EstablishNeighborIndices();
+
+  const size_t num_cells = grid.local_cells.size();
+
+  //======================================== Count
+  size_t num_faces = 0;
+  size_t num_cell_vids = 0;
+  size_t num_face_vids = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    num_faces     += cell.faces.size();
+    num_cell_vids += cell.vertex_ids.size();
+    for (const auto& face : cell.faces)
+      num_face_vids += face.vertex_ids.size();
+  }
+
+  //======================================== Allocate
+  cell_global_ids.clear();     cell_global_ids.reserve(num_cells);
+  cell_centroids.clear();      cell_centroids.reserve(num_cells);
+  cell_face_offsets.assign(1,0);   cell_face_offsets.reserve(num_cells+1);
+  cell_vertex_offsets.assign(1,0); cell_vertex_offsets.reserve(num_cells+1);
+  cell_vertex_ids.clear();     cell_vertex_ids.reserve(num_cell_vids);
+
+  face_vertex_offsets.assign(1,0); face_vertex_offsets.reserve(num_faces+1);
+  face_vertex_ids.clear();     face_vertex_ids.reserve(num_face_vids);
+  face_normals.clear();        face_normals.reserve(num_faces);
+  face_centroids.clear();      face_centroids.reserve(num_faces);
+  face_has_neighbor.clear();   face_has_neighbor.reserve(num_faces);
+  face_neighbor_ids.clear();   face_neighbor_ids.reserve(num_faces);
+  face_neighbor_local_ids.clear();     face_neighbor_local_ids.reserve(num_faces);
+  face_neighbor_partition_ids.clear(); face_neighbor_partition_ids.reserve(num_faces);
+
+  //======================================== Pack cells and faces
+  for (const auto& cell : grid.local_cells)
+  {
+    cell_global_ids.push_back(cell.global_id);
+    cell_centroids.push_back(cell.centroid);
+    cell_vertex_ids.insert(cell_vertex_ids.end(),
+                           cell.vertex_ids.begin(), cell.vertex_ids.end());
+    cell_vertex_offsets.push_back(cell_vertex_ids.size());
+
+    for (const auto& face : cell.faces)
+    {
+      face_vertex_ids.insert(face_vertex_ids.end(),
+                             face.vertex_ids.begin(), face.vertex_ids.end());
+      face_vertex_offsets.push_back(face_vertex_ids.size());
+      face_normals.push_back(face.normal);
+      face_centroids.push_back(face.centroid);
+      face_has_neighbor.push_back(face.has_neighbor);
+      face_neighbor_ids.push_back(face.neighbor_id);
+
+      face_neighbor_local_ids.push_back(face.neighbor_local_id);
+      face_neighbor_partition_ids.push_back(face.neighbor_partition_id);
+    }
+    cell_face_offsets.push_back(face_normals.size());
+  }
+
+  //======================================== Pack vertices
+  vertices.clear();
+  vertices.reserve(grid.vertices.size());
+  for (const auto vertex : grid.vertices)
+    vertices.push_back((vertex != nullptr)? *vertex : chi_mesh::Vector3());
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "Packed mesh view built. Memory = "
+    << std::setprecision(3) << MemoryInBytes()/1024.0/1024.0 << " MB";
+}
+
+//###################################################################
+/**Returns the memory occupied by the view's arrays.*/
+size_t chi_mesh::PackedMeshView::MemoryInBytes() const
+{
+  size_t num_bytes = 0;
+  num_bytes += cell_global_ids.capacity()*sizeof(uint64_t);
+  num_bytes += cell_centroids.capacity()*sizeof(Vector3);
+  num_bytes += cell_face_offsets.capacity()*sizeof(uint64_t);
+  num_bytes += cell_vertex_offsets.capacity()*sizeof(uint64_t);
+  num_bytes += cell_vertex_ids.capacity()*sizeof(uint64_t);
+
+  num_bytes += face_vertex_offsets.capacity()*sizeof(uint64_t);
+  num_bytes += face_vertex_ids.capacity()*sizeof(uint64_t);
+  num_bytes += face_normals.capacity()*sizeof(Vector3);
+  num_bytes += face_centroids.capacity()*sizeof(Vector3);
+  num_bytes += face_has_neighbor.capacity()*sizeof(char);
+  num_bytes += face_neighbor_ids.capacity()*sizeof(uint64_t);
+  num_bytes += face_neighbor_local_ids.capacity()*sizeof(int64_t);
+  num_bytes += face_neighbor_partition_ids.capacity()*sizeof(int);
+
+  num_bytes += vertices.capacity()*sizeof(Vector3);
+  return num_bytes;
+}
+
+//###################################################################
+/**Returns the packed view of the local cells, building it on the first
+ * call. The first call must not be made concurrently.*/
+const chi_mesh::PackedMeshView& chi_mesh::MeshContinuum::GetPackedView()
+{
+  if (not packed_view)
+  {
+    packed_view.reset(new PackedMeshView());
+    packed_view->Build(*this);
+  }
+  return *packed_view;
+}
@@ -0,0 +1,73 @@
+#ifndef CHI_MESHCONTINUUM_PACKEDVIEW_H_
+#define CHI_MESHCONTINUUM_PACKEDVIEW_H_
+
+#include "ChiMesh/chi_mesh.h"
+
+#include <vector>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Read-only, structure-of-arrays copy of the local cells of a
+ * MeshContinuum.
+ *
+ * Cells are indexed by local id. The faces of cell c are the global face
+ * indices cell_face_offsets[c] to cell_face_offsets[c+1]-1, in the same
+ * order as cell.faces. Vertex lists are stored in CSR form. The view is
+ * built on demand with MeshContinuum::GetPackedView() and is discarded
+ * with MeshContinuum::InvalidatePackedView() whenever the cells change,
+ * for example when boundary ids are reassigned. Material ids are not
+ * part of the view, solvers cache what they derive from them.*/
+class PackedMeshView
+{
+public:
+  //Cells
+  std::vector<uint64_t> cell_global_ids;
+  std::vector<Vector3>  cell_centroids;
+  std::vector<uint64_t> cell_face_offsets;   ///< Size num_cells+1
+  std::vector<uint64_t> cell_vertex_offsets; ///< Size num_cells+1
+  std::vector<uint64_t> cell_vertex_ids;
+
+  //Faces
+  std::vector<uint64_t> face_vertex_offsets; ///< Size num_faces+1
+  std::vector<uint64_t> face_vertex_ids;
+  std::vector<Vector3>  face_normals;
+  std::vector<Vector3>  face_centroids;
+  std::vector<char>     face_has_neighbor;
+  std::vector<uint64_t> face_neighbor_ids;   ///< Global id or boundary index
+  std::vector<int64_t>  face_neighbor_local_ids;     ///< -1 if not local
+  std::vector<int>      face_neighbor_partition_ids; ///< -1 on boundaries
+
+  //Vertices
+  std::vector<Vector3>  vertices;
+
+public:
+  void Build(MeshContinuum& grid);
+
+  size_t NumCells() const {return cell_global_ids.size();}
+  size_t NumFaces() const {return face_normals.size();}
+
+  /**Global face index of face f of a local cell.*/
+  uint64_t FaceIndex(uint64_t cell_local_id, size_t f) const
+  {return cell_face_offsets[cell_local_id] + f;}
+
+  size_t NumCellFaces(uint64_t cell_local_id) const
+  {return cell_face_offsets[cell_local_id+1] - cell_face_offsets[cell_local_id];}
+
+  size_t NumFaceVertices(uint64_t face_index) const
+  {return face_vertex_offsets[face_index+1] - face_vertex_offsets[face_index];}
+
+  /**Pointer to the first vertex id of a face.*/
+  const uint64_t* FaceVertexIds(uint64_t face_index) const
+  {return &face_vertex_ids[face_vertex_offsets[face_index]];}
+
+  bool IsNeighborLocal(uint64_t face_index) const
+  {return face_neighbor_local_ids[face_index] >= 0;}
+
+  size_t MemoryInBytes() const;
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_PACKEDVIEW_H_
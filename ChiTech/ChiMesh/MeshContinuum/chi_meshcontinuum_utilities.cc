@@ -164,12 +164,7 @@ size_t chi_mesh::MeshContinuum::GetFaceHistogramBinDOFSize(size_t category)
  * the native index map.*/
 bool chi_mesh::MeshContinuum::IsCellLocal(uint64_t cell_global_index)
 {
-  auto native_index = global_cell_id_to_native_id_map.find(cell_global_index);
-
-  if (native_index != global_cell_id_to_native_id_map.end())
-    return true;
-
-  return false;
+  return global_cell_id_to_native_id_map.Contains(cell_global_index);
 }
 
 
@@ -178,18 +173,41 @@ bool chi_mesh::MeshContinuum::IsCellLocal(uint64_t cell_global_index)
  * found in the native or foreign cell maps.*/
 bool chi_mesh::MeshContinuum::IsCellBndry(uint64_t cell_global_index)
 {
-  auto native_index = global_cell_id_to_native_id_map.find(cell_global_index);
-  auto foreign_index = global_cell_id_to_foreign_id_map.find(cell_global_index);
-
-  auto no_native = global_cell_id_to_native_id_map.end();
-  auto no_foreign = global_cell_id_to_foreign_id_map.end();
-
-  if ( (native_index == no_native) and (foreign_index == no_foreign))
+  if ( (not global_cell_id_to_native_id_map.Contains(cell_global_index)) and
+       (not global_cell_id_to_foreign_id_map.Contains(cell_global_index)) )
     return true;
 
   return false;
 }
 
+//###################################################################
+/**Stores the partition id and, if local, the local id of the neighbor of
+ * every face of the local cells on the faces themselves. After this,
+ * CellFace::IsNeighborLocal, GetNeighborPartitionID and GetNeighborLocalID
+ * do not look up global ids. Must be called once all local and ghost
+ * cells have been added. Neighbors not found in the grid are left
+ * unestablished.*/
+void chi_mesh::MeshContinuum::EstablishNeighborIndices()
+{
+  for (auto cell : native_cells)
+    for (auto& face : cell->faces)
+    {
+      face.neighbor_local_id = -1;
+      face.neighbor_partition_id = -1;
+      if (not face.has_neighbor) continue;
+
+      uint64_t index;
+      if (global_cell_id_to_native_id_map.Find(face.neighbor_id, index))
+      {
+        face.neighbor_local_id = static_cast<int64_t>(native_cells[index]->local_id);
+        face.neighbor_partition_id = chi_mpi.location_id;
+      }
+      else if (global_cell_id_to_foreign_id_map.Find(face.neighbor_id, index))
+        face.neighbor_partition_id =
+          static_cast<int>(foreign_cells[index]->partition_id);
+    }
+}
+
 
 
 //###################################################################
@@ -0,0 +1,121 @@
+#include "../../../ChiLua/chi_lua.h"
+#include "../chi_region.h"
+#include "../../MeshHandler/chi_meshhandler.h"
+#include "../../MeshContinuum/chi_meshcontinuum.h"
+#include "../../UnpartitionedMesh/chi_unpartitioned_mesh.h"
+#include "../../VolumeMesher/PredefinedUnpartitioned/volmesher_predefunpart.h"
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+//#############################################################################
+/** Writes the mesh of a region to binary per-process checkpoint files.
+ * The files hold the local and ghost cells, faces, neighbor-, material-
+ * and partition ids, and the vertices, and are read back with
+ * chiMeshReadCheckpoint.
+
+\param RegionHandle int Handle to the region.
+\param FolderName char Folder in which to write the files.
+\param FileBase char Base name of the files.
+
+\ingroup LuaRegion*/
+int chiRegionExportMeshToCheckpoint(lua_State *L)
+{
+  //============================================= Check arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiRegionExportMeshToCheckpoint",3,num_args);
+
+  int region_index = lua_tonumber(L,1);
+  const char* folder_name = lua_tostring(L,2);
+  const char* file_base   = lua_tostring(L,3);
+
+  //============================================= Get current handler
+  chi_mesh::MeshHandler* cur_hndlr = chi_mesh::GetCurrentHandler();
+
+  //============================================= Attempt to obtain region
+  chi_mesh::Region* cur_region;
+  try{
+    cur_region = cur_hndlr->region_stack.at(region_index);
+  }
+  catch(const std::out_of_range& oor)
+  {
+    chi_log.Log(LOG_ALLERROR) << "ERROR: Invalid index to region in "
+                                 "chiRegionExportMeshToCheckpoint.";
+    exit(EXIT_FAILURE);
+  }
+
+  auto vol_cont = cur_region->GetGrid();
+  vol_cont->WriteCheckpoint(folder_name, file_base);
+
+  return 0;
+}
+
+//#############################################################################
+/** Loads a mesh checkpoint written by chiRegionExportMeshToCheckpoint
+ * into the latest region of the current handler, in place of executing a
+ * volume mesher.
+
+ When the process count matches the one the checkpoint was written with,
+ every process reads its own file and the partitioning is kept. Otherwise
+ the files are divided amongst the processes and the mesh is
+ repartitioned with VOLUMEMESHER_UNPARTITIONED.
+
+\param FolderName char Folder holding the files.
+\param FileBase char Base name of the files.
+
+\ingroup LuaRegion*/
+int chiMeshReadCheckpoint(lua_State *L)
+{
+  //============================================= Check arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 2)
+    LuaPostArgAmountError("chiMeshReadCheckpoint",2,num_args);
+
+  const std::string folder_name = lua_tostring(L,1);
+  const std::string file_base   = lua_tostring(L,2);
+
+  //============================================= Get current handler
+  chi_mesh::MeshHandler* cur_hndlr = chi_mesh::GetCurrentHandler();
+
+  if (cur_hndlr->region_stack.empty())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "chiMeshReadCheckpoint: No region added.";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Get the volume mesher
+  //Partitioning options set on an existing
+  //unpartitioned mesher are honored.
+  auto mesher = dynamic_cast<chi_mesh::VolumeMesherPredefinedUnpartitioned*>(
+    cur_hndlr->volume_mesher);
+  if (mesher == nullptr)
+  {
+    mesher = new chi_mesh::VolumeMesherPredefinedUnpartitioned;
+    cur_hndlr->volume_mesher = mesher;
+  }
+
+  auto info = chi_mesh::MeshContinuum::ReadCheckpointInfo(folder_name,
+                                                          file_base);
+
+  //============================================= Same process count
+  if (info.process_count == chi_mpi.process_count)
+  {
+    auto grid = chi_mesh::MeshContinuum::New();
+    grid->ReadCheckpoint(folder_name, file_base);
+    mesher->AddContinuumToRegion(grid, *cur_hndlr->region_stack.back());
+    return 0;
+  }
+
+  //============================================= Repartition
+  auto umesh = new chi_mesh::UnpartitionedMesh;
+  umesh->ReadFromCheckpoint(folder_name, file_base);
+  cur_hndlr->unpartitionedmesh_stack.push_back(umesh);
+
+  mesher->Execute();
+
+  return 0;
+}
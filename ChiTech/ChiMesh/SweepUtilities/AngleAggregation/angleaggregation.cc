@@ -6,6 +6,10 @@ extern ChiLog& chi_log;
 #include "chi_mpi.h"
 extern ChiMPI& chi_mpi;
 
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
 //###################################################################
 /** Sets up the angle-aggregation object. */
 void chi_mesh::sweep_management::AngleAggregation::
@@ -55,11 +59,11 @@ void chi_mesh::sweep_management::AngleAggregation::ZeroOutgoingDelayedPsi()
   for (auto& angsetgrp : angle_set_groups)
     for (auto& angset : angsetgrp.angle_sets)
       for (auto& delayed_data : angset->delayed_prelocI_outgoing_psi)
-        delayed_data.assign(delayed_data.size(),0.0);
+        delayed_data.Zero();
 
   for (auto& angsetgrp : angle_set_groups)
     for (auto& angset : angsetgrp.angle_sets)
-      angset->delayed_local_psi.assign(angset->delayed_local_psi.size(),0.0);
+      angset->delayed_local_psi.Zero();
 }
 
 //###################################################################
@@ -376,4 +380,78 @@ DisassembleAngularUnknowns(int &index, const double* x_ref)
       for (auto& loc_vector : angle_set->delayed_prelocI_outgoing_psi_old)
         for (auto& val : loc_vector)
         {index++; val = x_ref[index];}
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Logs the memory used by the angular flux buffers of the FLUDS, per
+ * category, summed over all locations and maximized over locations.
+ * The local psi of all the anglesets shares one arena, hence it
+ * counts once per location. The local psi high-water mark is the
+ * largest amount of local psi actually held in flight by an angleset,
+ * whereas local psi is the allocation, which sizes each face category
+ * for its own peak.*/
+void chi_mesh::sweep_management::AngleAggregation::ReportFLUDSMemory()
+{
+  enum Category {LOCAL=0, DELAYED_LOCAL, DELAYED_NONLOCAL,
+                 UPSTREAM_NONLOCAL, DOWNSTREAM_NONLOCAL, ARENA,
+                 LOCAL_HIGH_WATER, NUM_CATEGORIES};
+  const std::vector<std::string> category_names =
+    {"Local psi", "Delayed local psi", "Delayed non-local psi",
+     "Upstream non-local psi", "Downstream non-local psi",
+     "Total arena capacity", "Local psi high-water mark"};
+
+  auto BufferBytes = [](const std::vector<PsiBuffer>& buffers)
+  {
+    size_t bytes = 0;
+    for (const auto& buffer : buffers)
+      bytes += FLUDSArena::PaddedSize(buffer.size())*sizeof(double);
+    return bytes;
+  };
+
+  std::vector<unsigned long long> local_bytes(NUM_CATEGORIES,0);
+  size_t max_local_psi_size = 0;
+  for (auto& as_group : angle_set_groups)
+    for (auto& angle_set : as_group.angle_sets)
+    {
+      max_local_psi_size = std::max(max_local_psi_size,
+                                    angle_set->GetLocalPsiSize());
+
+      unsigned long long high_water =
+        angle_set->fluds->local_psi_high_water_mark*
+        angle_set->GetNumGrps()*angle_set->angles.size()*sizeof(double);
+      local_bytes[LOCAL_HIGH_WATER] =
+        std::max(local_bytes[LOCAL_HIGH_WATER], high_water);
+
+      local_bytes[DELAYED_LOCAL] +=
+        FLUDSArena::PaddedSize(angle_set->delayed_local_psi.size())*
+        sizeof(double)*2;
+      local_bytes[DELAYED_NONLOCAL] +=
+        BufferBytes(angle_set->delayed_prelocI_outgoing_psi) +
+        BufferBytes(angle_set->delayed_prelocI_outgoing_psi_old);
+      local_bytes[UPSTREAM_NONLOCAL] +=
+        BufferBytes(angle_set->prelocI_outgoing_psi);
+      local_bytes[DOWNSTREAM_NONLOCAL] +=
+        BufferBytes(angle_set->deplocI_outgoing_psi);
+      local_bytes[ARENA] += angle_set->psi_arena.GetCapacityBytes();
+    }
+  local_bytes[LOCAL] = max_local_psi_size*sizeof(double);
+  local_bytes[ARENA] += local_bytes[LOCAL];
+
+  std::vector<unsigned long long> global_sum(NUM_CATEGORIES,0);
+  std::vector<unsigned long long> global_max(NUM_CATEGORIES,0);
+  MPI_Allreduce(local_bytes.data(), global_sum.data(), NUM_CATEGORIES,
+                MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(local_bytes.data(), global_max.data(), NUM_CATEGORIES,
+                MPI_UNSIGNED_LONG_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+  const double MB = 1024.0*1024.0;
+  std::stringstream outstr;
+  outstr << "FLUDS memory (total/max per location) [MB]:\n";
+  for (int c=0; c<NUM_CATEGORIES; c++)
+    outstr << "  " << std::left << std::setw(26) << category_names[c]
+           << std::right << std::fixed << std::setprecision(3)
+           << std::setw(12) << global_sum[c]/MB
+           << std::setw(12) << global_max[c]/MB << "\n";
+
+  chi_log.Log(LOG_0) << outstr.str();
+}
@@ -33,6 +33,10 @@ public:
   int                                          number_of_groups=0;
   int                                          number_of_group_subsets=0;
   std::shared_ptr<chi_math::AngularQuadrature> quadrature=nullptr;
+  ///Optional. Coalesces sweep messages across anglesets.
+  std::shared_ptr<SweepMessageAggregator>      message_aggregator=nullptr;
+  ///Optional. Local psi arena shared with other angle aggregations.
+  std::shared_ptr<FLUDSArena>                  local_psi_arena=nullptr;
 
 private:
   bool is_setup=false;
@@ -60,6 +64,8 @@ public:
   void AssembleAngularUnknowns(int& index, double* x_ref);
   void DisassembleAngularUnknowns(int& index, const double* x_ref);
 
+  void ReportFLUDSMemory();
+
 };
 
 
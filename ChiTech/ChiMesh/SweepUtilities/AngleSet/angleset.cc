@@ -32,6 +32,7 @@ AngleSet(int in_numgrps,
             std::back_inserter(angles));
 
   fluds = in_fluds;
+  local_psi_arena = std::make_shared<FLUDSArena>();
 
   sweep_buffer.BuildMessageStructure();
 
@@ -151,9 +152,52 @@ void chi_mesh::sweep_management::AngleSet::ResetSweepBuffers()
 
 //###################################################################
 /**Instructs the sweep buffer to receive delayed data.*/
-void chi_mesh::sweep_management::AngleSet::ReceiveDelayedData(int angle_set_num)
+chi_mesh::sweep_management::AngleSetStatus
+  chi_mesh::sweep_management::AngleSet::ReceiveDelayedData(int angle_set_num)
+{
+  return sweep_buffer.ReceiveDelayedData(angle_set_num);
+}
+
+//###################################################################
+/**Returns the accumulated time, in seconds, that this angleset has
+ * waited for upstream data since its construction.*/
+double chi_mesh::sweep_management::AngleSet::GetWaitTime()
+{
+  return sweep_buffer.GetWaitTime();
+}
+
+//###################################################################
+/**Routes the sweep buffer's messages through a message aggregator.
+ * Passing nullptr restores direct sends.*/
+void chi_mesh::sweep_management::AngleSet::
+SetMessageAggregator(SweepMessageAggregator* aggregator)
 {
-  sweep_buffer.ReceiveDelayedData(angle_set_num);
+  sweep_buffer.SetMessageAggregator(aggregator);
+}
+
+//###################################################################
+/**Delivers a message received by the message aggregator.*/
+void chi_mesh::sweep_management::AngleSet::
+DeliverMessage(int angle_set_num, int locJ, int message_num,
+               const double* data, size_t size)
+{
+  sweep_buffer.DeliverMessage(angle_set_num, locJ, message_num, data, size);
+}
+
+//###################################################################
+/**Returns the number of messages sent directly by the sweep buffer
+ * since its construction.*/
+size_t chi_mesh::sweep_management::AngleSet::GetNumMessagesSent()
+{
+  return sweep_buffer.GetNumMessagesSent();
+}
+
+//###################################################################
+/**Returns the number of bytes sent directly by the sweep buffer since
+ * its construction.*/
+size_t chi_mesh::sweep_management::AngleSet::GetNumBytesSent()
+{
+  return sweep_buffer.GetNumBytesSent();
 }
 
 //###################################################################
@@ -198,4 +242,17 @@ ReflectingPsiOutBoundBndry(int bndry_map,
                                                             face_num,
                                                             fi,
                                                             gs_ss_begin);
-}
\ No newline at end of file
+}
+//###################################################################
+/**Returns the number of values in the local psi buffers of all face
+ * categories, each padded to the arena alignment.*/
+size_t chi_mesh::sweep_management::AngleSet::GetLocalPsiSize()
+{
+  size_t num_angles = angles.size();
+  size_t local_psi_size = 0;
+  for (size_t fc=0; fc<fluds->num_face_categories; fc++)
+    local_psi_size += FLUDSArena::PaddedSize(fluds->local_psi_stride[fc]*
+                                             fluds->local_psi_max_elements[fc]*
+                                             num_grps*num_angles);
+  return local_psi_size;
+}
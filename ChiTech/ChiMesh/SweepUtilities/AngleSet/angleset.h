@@ -29,16 +29,21 @@ public:
   std::vector<std::shared_ptr<SweepBndry>>&         ref_boundaries;
   int                               ref_subset;
 
-  //FLUDS
-  std::vector<std::vector<double>>  local_psi;
-  std::vector<double>               delayed_local_psi;
-  std::vector<double>               delayed_local_psi_old;
-  std::vector<std::vector<double>>  deplocI_outgoing_psi;
-  std::vector<std::vector<double>>  prelocI_outgoing_psi;
-  std::vector<std::vector<double>>  boundryI_incoming_psi;
-
-  std::vector<std::vector<double>>  delayed_prelocI_outgoing_psi;
-  std::vector<std::vector<double>>  delayed_prelocI_outgoing_psi_old;
+  //FLUDS. The local psi buffers are carved from local_psi_arena, which
+  //is shared by anglesets that never execute concurrently, all other
+  //buffers from psi_arena.
+  FLUDSArena                        psi_arena;
+  std::shared_ptr<FLUDSArena>       local_psi_arena;
+
+  std::vector<PsiBuffer>            local_psi;
+  PsiBuffer                         delayed_local_psi;
+  PsiBuffer                         delayed_local_psi_old;
+  std::vector<PsiBuffer>            deplocI_outgoing_psi;
+  std::vector<PsiBuffer>            prelocI_outgoing_psi;
+  std::vector<PsiBuffer>            boundryI_incoming_psi;
+
+  std::vector<PsiBuffer>            delayed_prelocI_outgoing_psi;
+  std::vector<PsiBuffer>            delayed_prelocI_outgoing_psi_old;
   std::vector<double>               delayed_prelocI_norm;
   double                            delayed_local_norm;
 
@@ -68,7 +73,14 @@ public:
              ExecutionPermission permission = ExecutionPermission::EXECUTE);
   AngleSetStatus FlushSendBuffers();
   void ResetSweepBuffers();
-  void ReceiveDelayedData(int angle_set_num);
+  AngleSetStatus ReceiveDelayedData(int angle_set_num);
+  double GetWaitTime();
+  void SetMessageAggregator(SweepMessageAggregator* aggregator);
+  void DeliverMessage(int angle_set_num, int locJ, int message_num,
+                      const double* data, size_t size);
+  size_t GetNumMessagesSent();
+  size_t GetNumBytesSent();
+  size_t GetLocalPsiSize();
 
   double* PsiBndry(int bndry_map,
                    int angle_num,
@@ -38,6 +38,7 @@ chi_mesh::sweep_management::AUX_FLUDS::
   local_psi_stride               = primary.local_psi_stride;
   local_psi_max_elements         = primary.local_psi_max_elements;
   delayed_local_psi_stride       = primary.delayed_local_psi_stride;
+  local_psi_high_water_mark      = primary.local_psi_high_water_mark;
   delayed_local_psi_max_elements = primary.delayed_local_psi_max_elements;
   num_face_categories            = primary.num_face_categories;
 
@@ -56,15 +56,15 @@ private:
   //  its own interface vector
   //ref_delayed_prelocI_outgoing_psi[prelocI]. Each delayed predecessor
   //  location I has its own interface vector
-  std::vector<std::vector<double>>*  ref_local_psi;
-  std::vector<double>*               ref_delayed_local_psi;
-  std::vector<double>*               ref_delayed_local_psi_old;
-  std::vector<std::vector<double>>*  ref_deplocI_outgoing_psi;
-  std::vector<std::vector<double>>*  ref_prelocI_outgoing_psi;
-  std::vector<std::vector<double>>*  ref_boundryI_incoming_psi;
-
-  std::vector<std::vector<double>>*  ref_delayed_prelocI_outgoing_psi;
-  std::vector<std::vector<double>>*  ref_delayed_prelocI_outgoing_psi_old;
+  std::vector<PsiBuffer>*            ref_local_psi;
+  PsiBuffer*                         ref_delayed_local_psi;
+  PsiBuffer*                         ref_delayed_local_psi_old;
+  std::vector<PsiBuffer>*            ref_deplocI_outgoing_psi;
+  std::vector<PsiBuffer>*            ref_prelocI_outgoing_psi;
+  std::vector<PsiBuffer>*            ref_boundryI_incoming_psi;
+
+  std::vector<PsiBuffer>*            ref_delayed_prelocI_outgoing_psi;
+  std::vector<PsiBuffer>*            ref_delayed_prelocI_outgoing_psi_old;
 private:
   //======================================== Alpha elements
 
@@ -116,14 +116,14 @@ public:
   /**Passes pointers from sweep buffers to FLUDS so
    * that chunk utilities function as required. */
   void SetReferencePsi(
-    std::vector<std::vector<double>>*  local_psi,
-    std::vector<double>*               delayed_local_psi,
-    std::vector<double>*               delayed_local_psi_old,
-    std::vector<std::vector<double>>*  deplocI_outgoing_psi,
-    std::vector<std::vector<double>>*  prelocI_outgoing_psi,
-    std::vector<std::vector<double>>*  boundryI_incoming_psi,
-    std::vector<std::vector<double>>*  delayed_prelocI_outgoing_psi,
-    std::vector<std::vector<double>>*  delayed_prelocI_outgoing_psi_old)
+    std::vector<PsiBuffer>*            local_psi,
+    PsiBuffer*                         delayed_local_psi,
+    PsiBuffer*                         delayed_local_psi_old,
+    std::vector<PsiBuffer>*            deplocI_outgoing_psi,
+    std::vector<PsiBuffer>*            prelocI_outgoing_psi,
+    std::vector<PsiBuffer>*            boundryI_incoming_psi,
+    std::vector<PsiBuffer>*            delayed_prelocI_outgoing_psi,
+    std::vector<PsiBuffer>*            delayed_prelocI_outgoing_psi_old)
   override
   {
     ref_local_psi = local_psi;
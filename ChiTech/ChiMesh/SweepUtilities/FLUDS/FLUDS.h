@@ -6,6 +6,7 @@
 
 #include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
 #include <ChiMesh/Cell/cell.h>
+#include "FLUDS_arena.h"
 
 //face_slot index, vertex ids
 typedef std::pair<int,std::vector<uint64_t>>             CompactFaceView;
@@ -35,6 +36,7 @@ namespace chi_mesh::sweep_management
     std::vector<size_t> local_psi_max_elements;           //Number of faces in each cat
     size_t              delayed_local_psi_stride=0;       //Group-angle-faceDOF stride delayed cat
     size_t              delayed_local_psi_max_elements=0; //Number of faces in delayed cat
+    size_t              local_psi_high_water_mark=0;      //Max face DOFs in flight
 
   public:
     // This is a small vector [deplocI] that holds the number of
@@ -54,14 +56,14 @@ namespace chi_mesh::sweep_management
   public:
     virtual
     void SetReferencePsi(
-      std::vector<std::vector<double>>*  local_psi,
-      std::vector<double>*               delayed_local_psi,
-      std::vector<double>*               delayed_local_psi_old,
-      std::vector<std::vector<double>>*  deplocI_outgoing_psi,
-      std::vector<std::vector<double>>*  prelocI_outgoing_psi,
-      std::vector<std::vector<double>>*  boundryI_incoming_psi,
-      std::vector<std::vector<double>>*  delayed_prelocI_outgoing_psi,
-      std::vector<std::vector<double>>*  delayed_prelocI_outgoing_psi_old)=0;
+      std::vector<PsiBuffer>*            local_psi,
+      PsiBuffer*                         delayed_local_psi,
+      PsiBuffer*                         delayed_local_psi_old,
+      std::vector<PsiBuffer>*            deplocI_outgoing_psi,
+      std::vector<PsiBuffer>*            prelocI_outgoing_psi,
+      std::vector<PsiBuffer>*            boundryI_incoming_psi,
+      std::vector<PsiBuffer>*            delayed_prelocI_outgoing_psi,
+      std::vector<PsiBuffer>*            delayed_prelocI_outgoing_psi_old)=0;
 
     virtual
     double*  OutgoingPsi(int cell_so_index, int outb_face_counter,
@@ -80,22 +82,12 @@ namespace chi_mesh::sweep_management
     virtual ~FLUDS()=default;
   };
 
+  /**Upwind slot and dof mapping of an incoming face. The mappings of
+   * all faces are stored contiguously in a pool owned by the FLUDS.*/
   struct INCOMING_FACE_INFO
   {
     int slot_address=0;
-    short* upwind_dof_mapping = nullptr;
-
-    void Setup(const std::pair<int,std::vector<short>>& input)
-    {
-      slot_address = input.first;
-      upwind_dof_mapping = new short[input.second.size()];
-      std::copy(input.second.begin(),input.second.end(),upwind_dof_mapping);
-    }
-
-    ~INCOMING_FACE_INFO()
-    {
-      delete [] upwind_dof_mapping;
-    }
+    const short* upwind_dof_mapping = nullptr;
   };
 }
 
@@ -134,6 +126,7 @@ class chi_mesh::sweep_management::PRIMARY_FLUDS :
 private:
   int largest_face=0;
   int G=0;
+  size_t live_face_dofs=0; //Face DOFs in flight during slot dynamics
 
   //local_psi_n_block_stride[fc]. Given face category fc, the value is
   //total number of faces that store information in this category's buffer
@@ -153,15 +146,15 @@ private:
   //  its own interface vector
   //ref_delayed_prelocI_outgoing_psi[prelocI]. Each delayed predecessor
   //  location I has its own interface vector
-  std::vector<std::vector<double>>*  ref_local_psi = nullptr;
-  std::vector<double>*               ref_delayed_local_psi = nullptr;
-  std::vector<double>*               ref_delayed_local_psi_old = nullptr;
-  std::vector<std::vector<double>>*  ref_deplocI_outgoing_psi = nullptr;
-  std::vector<std::vector<double>>*  ref_prelocI_outgoing_psi = nullptr;
-  std::vector<std::vector<double>>*  ref_boundryI_incoming_psi = nullptr;
-
-  std::vector<std::vector<double>>*  ref_delayed_prelocI_outgoing_psi = nullptr;
-  std::vector<std::vector<double>>*  ref_delayed_prelocI_outgoing_psi_old = nullptr;
+  std::vector<PsiBuffer>*            ref_local_psi = nullptr;
+  PsiBuffer*                         ref_delayed_local_psi = nullptr;
+  PsiBuffer*                         ref_delayed_local_psi_old = nullptr;
+  std::vector<PsiBuffer>*            ref_deplocI_outgoing_psi = nullptr;
+  std::vector<PsiBuffer>*            ref_prelocI_outgoing_psi = nullptr;
+  std::vector<PsiBuffer>*            ref_boundryI_incoming_psi = nullptr;
+
+  std::vector<PsiBuffer>*            ref_delayed_prelocI_outgoing_psi = nullptr;
+  std::vector<PsiBuffer>*            ref_delayed_prelocI_outgoing_psi_old = nullptr;
 private:
   //======================================== Alpha elements
 
@@ -185,6 +178,14 @@ private:
   std::vector<INCOMING_FACE_INFO*>
     so_cell_inco_face_dof_indices;
 
+  // Contiguous storage of the incoming face infos of all cells and of
+  // their upwind dof mappings. so_cell_inco_face_dof_indices points into
+  // these once the alpha pass completes.
+  std::vector<INCOMING_FACE_INFO> inco_face_info_pool;
+  std::vector<short>              inco_face_dof_mapping_pool;
+  std::vector<size_t>             so_cell_inco_face_info_offset;
+  std::vector<size_t>             inco_face_dof_mapping_offset;
+
   // This is a vector [cell_sweep_order_index][incoming_face_count]
   // which holds the face categorization for the face. i.e. the local
   // psi vector that hold faces of the same category.
@@ -246,14 +247,14 @@ public:
   /**Passes pointers from sweep buffers to FLUDS so
    * that chunk utilities function as required. */
   void SetReferencePsi(
-    std::vector<std::vector<double>>*  local_psi,
-    std::vector<double>*               delayed_local_psi,
-    std::vector<double>*               delayed_local_psi_old,
-    std::vector<std::vector<double>>*  deplocI_outgoing_psi,
-    std::vector<std::vector<double>>*  prelocI_outgoing_psi,
-    std::vector<std::vector<double>>*  boundryI_incoming_psi,
-    std::vector<std::vector<double>>*  delayed_prelocI_outgoing_psi,
-    std::vector<std::vector<double>>*  delayed_prelocI_outgoing_psi_old)
+    std::vector<PsiBuffer>*            local_psi,
+    PsiBuffer*                         delayed_local_psi,
+    PsiBuffer*                         delayed_local_psi_old,
+    std::vector<PsiBuffer>*            deplocI_outgoing_psi,
+    std::vector<PsiBuffer>*            prelocI_outgoing_psi,
+    std::vector<PsiBuffer>*            boundryI_incoming_psi,
+    std::vector<PsiBuffer>*            delayed_prelocI_outgoing_psi,
+    std::vector<PsiBuffer>*            delayed_prelocI_outgoing_psi_old)
     override
   {
     ref_local_psi = local_psi;
@@ -269,7 +270,7 @@ public:
 public:
   typedef std::shared_ptr<chi_mesh::sweep_management::SPDS> SPDS_ptr;
   //alphapass.cc
-  void InitializeAlphaElements(SPDS_ptr spds);
+  void InitializeAlphaElements(SPDS_ptr spds, bool concurrent_levels=false);
 
   void AddFaceViewToDepLocI(int deplocI, int cell_g_index,
                             int face_slot, chi_mesh::CellFace& face);
@@ -279,7 +280,8 @@ public:
                     SPDS_ptr spds,
                     std::vector<std::vector<std::pair<int,short>>>& lock_boxes,
                     std::vector<std::pair<int,short>>& delayed_lock_box,
-                    std::set<int>& location_boundary_dependency_set);
+                    std::set<int>& location_boundary_dependency_set,
+                    std::vector<std::pair<size_t,int>>* deferred_releases=nullptr);
   //alphapass_inc_mapping.cc
   void LocalIncidentMapping(chi_mesh::Cell *cell,
                             SPDS_ptr spds,
@@ -300,6 +302,10 @@ public:
   void NonLocalIncidentMapping(chi_mesh::Cell *cell,
                                SPDS_ptr spds);
 
+  //FLUDS_serialize.cc
+  void Serialize(std::ostream& file, SPDS_ptr spds) const;
+  void Deserialize(std::istream& file);
+
   //FLUDS_chunk_utilities.cc
   double*  OutgoingPsi(int cell_so_index, int outb_face_counter,
                        int face_dof, int n) override;
@@ -316,7 +322,6 @@ public:
   {
     for (auto& val : so_cell_outb_face_slot_indices) delete [] val;
     for (auto& val : so_cell_outb_face_face_category) delete [] val;
-    for (auto& val : so_cell_inco_face_dof_indices) delete [] val;
     for (auto& val : so_cell_inco_face_face_category) delete [] val;
 
   }
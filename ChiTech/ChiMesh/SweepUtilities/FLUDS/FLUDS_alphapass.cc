@@ -11,9 +11,12 @@ extern ChiLog&     chi_log;
 typedef std::vector<std::pair<int,short>> LockBox;
 
 //###################################################################
-/**Populates a flux data structure.*/
+/**Populates a flux data structure. If concurrent_levels is true then
+ * face slots freed by a cell are not reused by cells on the same
+ * sweep level, which allows the cells of a level to execute
+ * concurrently.*/
 void chi_mesh::sweep_management::PRIMARY_FLUDS::
-InitializeAlphaElements(SPDS_ptr spds)
+InitializeAlphaElements(SPDS_ptr spds, bool concurrent_levels)
 {
   chi_mesh::MeshContinuumPtr         grid = spds->grid;
   chi_mesh::sweep_management::SPLS& spls = spds->spls;
@@ -46,12 +49,34 @@ InitializeAlphaElements(SPDS_ptr spds)
   LockBox              delayed_lock_box;
   std::set<int> location_boundary_dependency_set;
 
+  std::vector<std::pair<size_t,int>> deferred_releases;
+  auto deferred_releases_ptr = (concurrent_levels)? &deferred_releases :
+                                                     nullptr;
+  size_t level = 0;
+  live_face_dofs = 0;
+  local_psi_high_water_mark = 0;
+
   // csoi = cell sweep order index
   so_cell_inco_face_face_category.reserve(spls.item_id.size());
   so_cell_outb_face_slot_indices.reserve(spls.item_id.size());
   so_cell_outb_face_face_category.reserve(spls.item_id.size());
   for (int csoi=0; csoi<spls.item_id.size(); csoi++)
   {
+    //=========================================== Release slots of the
+    //                                            previous level
+    if (concurrent_levels and level<spls.levels.size() and
+        csoi == spls.levels[level])
+    {
+      for (auto& release : deferred_releases)
+      {
+        lock_boxes[release.first][release.second].first = -1;
+        lock_boxes[release.first][release.second].second= -1;
+        live_face_dofs -= grid->GetFaceHistogramBinDOFSize(release.first);
+      }
+      deferred_releases.clear();
+      ++level;
+    }
+
     int cell_local_id = spls.item_id[csoi];
     auto cell = &grid->local_cells[cell_local_id];
 
@@ -61,8 +86,11 @@ InitializeAlphaElements(SPDS_ptr spds)
                  spds,
                  lock_boxes,
                  delayed_lock_box,
-                 location_boundary_dependency_set);
+                 location_boundary_dependency_set,
+                 deferred_releases_ptr);
 
+    local_psi_high_water_mark = std::max(local_psi_high_water_mark,
+                                         live_face_dofs);
   }//for csoi
 
   chi_log.Log(LOG_0VERBOSE_2) << "Done with Slot Dynamics.";
@@ -79,7 +107,7 @@ InitializeAlphaElements(SPDS_ptr spds)
   //                      PERFORM INCIDENT MAPPING
   //================================================== Loop over cells in
   //                                                   sweep order
-  so_cell_inco_face_dof_indices.reserve(spls.item_id.size());
+  so_cell_inco_face_info_offset.reserve(spls.item_id.size());
   for (int csoi=0; csoi<spls.item_id.size(); csoi++)
   {
     int cell_local_id = spls.item_id[csoi];
@@ -89,6 +117,21 @@ InitializeAlphaElements(SPDS_ptr spds)
 
   }//for csoi
 
+  //================================================== Resolve pool pointers
+  inco_face_info_pool.shrink_to_fit();
+  inco_face_dof_mapping_pool.shrink_to_fit();
+  for (size_t i=0; i<inco_face_info_pool.size(); ++i)
+    inco_face_info_pool[i].upwind_dof_mapping =
+      inco_face_dof_mapping_pool.data() + inco_face_dof_mapping_offset[i];
+
+  so_cell_inco_face_dof_indices.reserve(spls.item_id.size());
+  for (size_t offset : so_cell_inco_face_info_offset)
+    so_cell_inco_face_dof_indices.push_back(
+      inco_face_info_pool.data() + offset);
+
+  so_cell_inco_face_info_offset = std::vector<size_t>();
+  inco_face_dof_mapping_offset  = std::vector<size_t>();
+
   for (size_t fc=0; fc<num_face_categories; ++fc)
   {
     local_psi_stride[fc] = grid->GetFaceHistogramBinDOFSize(fc);
@@ -10,13 +10,16 @@ typedef std::vector<std::pair<int,short>> LockBox;
 extern ChiLog& chi_log;
 
 //###################################################################
-/**Performs slot dynamics for Polyhedron cell.*/
+/**Performs slot dynamics for Polyhedron cell. Only faces with a local
+ * downstream neighbor occupy a slot, hence live_face_dofs tracks the
+ * face dofs held in flight per group and angle.*/
 void chi_mesh::sweep_management::PRIMARY_FLUDS::
   SlotDynamics(chi_mesh::Cell *cell,
                SPDS_ptr spds,
                std::vector<std::vector<std::pair<int,short>>>& lock_boxes,
                std::vector<std::pair<int,short>>& delayed_lock_box,
-               std::set<int>& location_boundary_dependency_set)
+               std::set<int>& location_boundary_dependency_set,
+               std::vector<std::pair<size_t,int>>* deferred_releases)
 {
   chi_mesh::MeshContinuumPtr grid = spds->grid;
 
@@ -80,14 +83,23 @@ void chi_mesh::sweep_management::PRIMARY_FLUDS::
         auto ass_face = (short)face.GetNeighborAssociatedFace(*grid);
 
         //Now find the cell (index,face) pair in the lock box and empty slot
+        //When levels are swept concurrently the slot is only released
+        //once the current level is complete.
         bool found = false;
-        for (auto& lock_box_slot : lock_box)
+        for (int k=0; k<lock_box.size(); k++)
         {
+          auto& lock_box_slot = lock_box[k];
           if ((lock_box_slot.first == face.neighbor_id) &&
               (lock_box_slot.second== ass_face))
           {
-            lock_box_slot.first = -1;
-            lock_box_slot.second= -1;
+            if (deferred_releases != nullptr)
+              deferred_releases->emplace_back(face_categ,k);
+            else
+            {
+              lock_box_slot.first = -1;
+              lock_box_slot.second= -1;
+              live_face_dofs -= grid->GetFaceHistogramBinDOFSize(face_categ);
+            }
             found = true;
             break;
           }
@@ -161,6 +173,7 @@ void chi_mesh::sweep_management::PRIMARY_FLUDS::
       outb_face_face_category.push_back(face_categ);
 
       LockBox* temp_lock_box = &lock_boxes[face_categ];
+      bool     is_cyclic     = false;
 
       //========================================== Check if part of cyclic
       //                                           dependency
@@ -175,6 +188,7 @@ void chi_mesh::sweep_management::PRIMARY_FLUDS::
 
           if ((a == c) && (b == d) )
           {
+            is_cyclic = true;
             temp_lock_box = &delayed_lock_box;
             outb_face_face_category.back() *= -1;
             outb_face_face_category.back() -= 1;
@@ -182,6 +196,7 @@ void chi_mesh::sweep_management::PRIMARY_FLUDS::
 
           if ((a == d) && (b == c) )
           {
+            is_cyclic = true;
             temp_lock_box = &delayed_lock_box;
             outb_face_face_category.back() *= -1;
             outb_face_face_category.back() -= 1;
@@ -196,27 +211,38 @@ void chi_mesh::sweep_management::PRIMARY_FLUDS::
       if (num_face_dofs>largest_face)
         largest_face = num_face_dofs;
 
-      //========================================== Find a open slot
-      bool slot_found = false;
-      for (int k=0; k<lock_box.size(); k++)
+      //========================================== Boundary and non-local
+      //                                           faces are never read
+      //                                           from local psi
+      bool needs_slot = face.IsNeighborLocal(*grid);
+      if (not needs_slot)
+        outb_face_slot_indices.push_back(-1);
+      else
       {
-        if (lock_box[k].first < 0)
+        if (not is_cyclic)
+          live_face_dofs += grid->GetFaceHistogramBinDOFSize(face_categ);
+
+        //======================================== Find a open slot
+        bool slot_found = false;
+        for (int k=0; k<lock_box.size(); k++)
         {
-          outb_face_slot_indices.push_back(k);
-          lock_box[k].first = cell_g_index;
-          lock_box[k].second= f;
-          slot_found = true;
-          break;
+          if (lock_box[k].first < 0)
+          {
+            outb_face_slot_indices.push_back(k);
+            lock_box[k].first = cell_g_index;
+            lock_box[k].second= f;
+            slot_found = true;
+            break;
+          }
         }
-      }
-
 
-      //========================================= If an open slot was not found
-      //                                          push a new one
-      if (!slot_found)
-      {
-        outb_face_slot_indices.push_back(lock_box.size());
-        lock_box.push_back(std::pair<int,short>(cell_g_index,f));
+        //======================================== If an open slot was not
+        //                                         found push a new one
+        if (not slot_found)
+        {
+          outb_face_slot_indices.push_back(lock_box.size());
+          lock_box.push_back(std::pair<int,short>(cell_g_index,f));
+        }
       }
 
       //========================================== Non-local outgoing
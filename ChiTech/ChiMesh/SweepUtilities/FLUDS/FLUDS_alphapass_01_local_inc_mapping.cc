@@ -79,11 +79,20 @@ LocalIncidentMapping(chi_mesh::Cell *cell,
     }//if incident
   }//for incindent f
 
-  auto inco_face_info_array = new INCOMING_FACE_INFO[inco_face_dof_mapping.size()];
-  for (int i=0; i<inco_face_dof_mapping.size(); ++i)
-    inco_face_info_array[i].Setup(inco_face_dof_mapping[i]);
-
-  so_cell_inco_face_dof_indices.push_back(inco_face_info_array);
-
+  //=================================================== Append to pools
+  // Pointers are resolved once all cells are mapped since the pools
+  // may still reallocate.
+  so_cell_inco_face_info_offset.push_back(inco_face_info_pool.size());
+  for (const auto& dof_mapping : inco_face_dof_mapping)
+  {
+    INCOMING_FACE_INFO face_info;
+    face_info.slot_address = dof_mapping.first;
+    inco_face_info_pool.push_back(face_info);
+
+    inco_face_dof_mapping_offset.push_back(inco_face_dof_mapping_pool.size());
+    inco_face_dof_mapping_pool.insert(inco_face_dof_mapping_pool.end(),
+                                      dof_mapping.second.begin(),
+                                      dof_mapping.second.end());
+  }
 
 }
\ No newline at end of file
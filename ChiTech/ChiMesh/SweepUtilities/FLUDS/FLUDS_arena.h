@@ -0,0 +1,117 @@
+#ifndef _chi_FLUDS_arena_h
+#define _chi_FLUDS_arena_h
+
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace chi_mesh
+{
+namespace sweep_management
+{
+  //###################################################################
+  /**Non-owning view of an angular flux buffer carved from a FLUDSArena.
+   * Assigning a view re-seats it, it does not copy the values.*/
+  class PsiBuffer
+  {
+  private:
+    double* values     = nullptr;
+    size_t  num_values = 0;
+
+  public:
+    PsiBuffer() = default;
+    PsiBuffer(double* in_values, size_t in_num_values) :
+      values(in_values), num_values(in_num_values) {}
+
+    double*       data()       {return values;}
+    const double* data() const {return values;}
+    size_t        size() const {return num_values;}
+    bool          empty()const {return num_values == 0;}
+
+    double&       operator[](size_t i)       {return values[i];}
+    const double& operator[](size_t i) const {return values[i];}
+
+    double*       begin()       {return values;}
+    double*       end()         {return values + num_values;}
+    const double* begin() const {return values;}
+    const double* end()   const {return values + num_values;}
+
+    void Zero() {if (num_values > 0) std::memset(values,0,num_values*sizeof(double));}
+  };
+
+  //###################################################################
+  /**Single contiguous, 64-byte aligned allocation from which the
+   * angular flux buffers of the FLUDS are carved. Every buffer starts on
+   * an alignment boundary. Carving again reuses the allocation, which
+   * only grows, hence previously carved views are invalidated.*/
+  class FLUDSArena
+  {
+  public:
+    static constexpr size_t ALIGNMENT = 64; ///< Bytes
+    static constexpr size_t ALIGNMENT_VALUES = ALIGNMENT/sizeof(double);
+
+  private:
+    double* storage  = nullptr;
+    size_t  capacity = 0; ///< Number of values
+
+  public:
+    FLUDSArena() = default;
+    ~FLUDSArena() {Release();}
+
+    FLUDSArena(const FLUDSArena&) = delete;
+    FLUDSArena& operator=(const FLUDSArena&) = delete;
+
+    /**Number of values a buffer occupies once padded to the alignment.*/
+    static size_t PaddedSize(size_t num_values)
+    {
+      return (num_values + ALIGNMENT_VALUES - 1)/ALIGNMENT_VALUES*
+             ALIGNMENT_VALUES;
+    }
+
+    /**Carves consecutive buffers of the given sizes, zero initialized.
+     * The allocation is grown when required.*/
+    std::vector<PsiBuffer> Carve(const std::vector<size_t>& buffer_sizes)
+    {
+      size_t total = 0;
+      for (size_t buffer_size : buffer_sizes)
+        total += PaddedSize(buffer_size);
+
+      if (total > capacity)
+      {
+        Release();
+        void* memory = nullptr;
+        if (posix_memalign(&memory, ALIGNMENT, total*sizeof(double)) != 0)
+          throw std::bad_alloc();
+        storage  = static_cast<double*>(memory);
+        capacity = total;
+      }
+
+      std::vector<PsiBuffer> buffers;
+      buffers.reserve(buffer_sizes.size());
+      size_t offset = 0;
+      for (size_t buffer_size : buffer_sizes)
+      {
+        buffers.emplace_back(storage + offset, buffer_size);
+        buffers.back().Zero();
+        offset += PaddedSize(buffer_size);
+      }
+
+      return buffers;
+    }
+
+    /**Frees the allocation. Memory from posix_memalign is released
+     * with free.*/
+    void Release()
+    {
+      std::free(storage);
+      storage  = nullptr;
+      capacity = 0;
+    }
+
+    size_t GetCapacityBytes() const {return capacity*sizeof(double);}
+  };
+}//namespace sweep_management
+}//namespace chi_mesh
+
+#endif
@@ -0,0 +1,149 @@
+#include "FLUDS.h"
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+#include "ChiMesh/SweepUtilities/SweepPlan/sweep_plan_io.h"
+
+#include <ChiMesh/Cell/cell.h>
+
+//###################################################################
+/**Writes the alpha and beta elements to a binary sweep-plan stream.
+ * The group-dependent strides are not written since they are recomputed
+ * from the group count of the FLUDS that reads the plan. The spds must
+ * be the one this FLUDS was built on.*/
+void chi_mesh::sweep_management::PRIMARY_FLUDS::
+Serialize(std::ostream& file, SPDS_ptr spds) const
+{
+  using namespace plan_io;
+  chi_mesh::MeshContinuumPtr grid = spds->grid;
+  const auto& spls = spds->spls;
+
+  //================================================== Base FLUDS
+  Write(file, static_cast<uint64_t>(num_face_categories));
+  WriteVector(file, local_psi_stride);
+  WriteVector(file, local_psi_max_elements);
+  Write(file, static_cast<uint64_t>(delayed_local_psi_stride));
+  Write(file, static_cast<uint64_t>(delayed_local_psi_max_elements));
+  Write(file, static_cast<uint64_t>(local_psi_high_water_mark));
+  WriteVector(file, deplocI_face_dof_count);
+  WriteVector(file, boundary_dependencies);
+  WriteVector(file, prelocI_face_dof_count);
+  WriteVector(file, delayed_prelocI_face_dof_count);
+
+  Write(file, largest_face);
+  WriteVector(file, local_psi_n_block_stride);
+
+  //================================================== Per-cell array lengths
+  std::vector<uint64_t> num_outb_faces;
+  std::vector<uint64_t> num_local_inco_faces;
+  num_outb_faces.reserve(spls.item_id.size());
+  num_local_inco_faces.reserve(spls.item_id.size());
+  for (int cell_local_id : spls.item_id)
+  {
+    const auto& cell = grid->local_cells[cell_local_id];
+    uint64_t num_outb = 0;
+    uint64_t num_inco = 0;
+    for (const auto& face : cell.faces)
+    {
+      double mu = spds->omega.Dot(face.normal);
+      if (mu >= (0.0+1.0e-16)) ++num_outb;
+      else if (mu < (0.0-1.0e-16) and face.IsNeighborLocal(*grid)) ++num_inco;
+    }
+    num_outb_faces.push_back(num_outb);
+    num_local_inco_faces.push_back(num_inco);
+  }
+
+  //================================================== Alpha elements
+  WriteArrays(file, so_cell_outb_face_slot_indices, num_outb_faces);
+  WriteArrays(file, so_cell_outb_face_face_category, num_outb_faces);
+  WriteArrays(file, so_cell_inco_face_face_category, num_local_inco_faces);
+
+  std::vector<uint64_t> info_offsets;
+  info_offsets.reserve(so_cell_inco_face_dof_indices.size());
+  for (const auto* face_info : so_cell_inco_face_dof_indices)
+    info_offsets.push_back(face_info - inco_face_info_pool.data());
+
+  std::vector<int>      slot_addresses;
+  std::vector<uint64_t> mapping_offsets;
+  slot_addresses.reserve(inco_face_info_pool.size());
+  mapping_offsets.reserve(inco_face_info_pool.size());
+  for (const auto& face_info : inco_face_info_pool)
+  {
+    slot_addresses.push_back(face_info.slot_address);
+    mapping_offsets.push_back(
+      face_info.upwind_dof_mapping - inco_face_dof_mapping_pool.data());
+  }
+
+  WriteVector(file, info_offsets);
+  WriteVector(file, slot_addresses);
+  WriteVector(file, mapping_offsets);
+  WriteVector(file, inco_face_dof_mapping_pool);
+
+  WriteVector(file, nonlocal_outb_face_deplocI_slot);
+
+  //================================================== Beta elements
+  WriteFaceMappings(file, nonlocal_inc_face_prelocI_slot_dof);
+  WriteFaceMappings(file, delayed_nonlocal_inc_face_prelocI_slot_dof);
+}
+
+//###################################################################
+/**Reads alpha and beta elements written by Serialize in place of the
+ * alpha and beta passes.*/
+void chi_mesh::sweep_management::PRIMARY_FLUDS::
+Deserialize(std::istream& file)
+{
+  using namespace plan_io;
+
+  //================================================== Base FLUDS
+  uint64_t value = 0;
+  Read(file, value); num_face_categories = value;
+  ReadVector(file, local_psi_stride);
+  ReadVector(file, local_psi_max_elements);
+  Read(file, value); delayed_local_psi_stride = value;
+  Read(file, value); delayed_local_psi_max_elements = value;
+  Read(file, value); local_psi_high_water_mark = value;
+  ReadVector(file, deplocI_face_dof_count);
+  ReadVector(file, boundary_dependencies);
+  ReadVector(file, prelocI_face_dof_count);
+  ReadVector(file, delayed_prelocI_face_dof_count);
+
+  Read(file, largest_face);
+  ReadVector(file, local_psi_n_block_stride);
+
+  //================================================== Alpha elements
+  ReadArrays(file, so_cell_outb_face_slot_indices);
+  ReadArrays(file, so_cell_outb_face_face_category);
+  ReadArrays(file, so_cell_inco_face_face_category);
+
+  std::vector<uint64_t> info_offsets;
+  std::vector<int>      slot_addresses;
+  std::vector<uint64_t> mapping_offsets;
+  ReadVector(file, info_offsets);
+  ReadVector(file, slot_addresses);
+  ReadVector(file, mapping_offsets);
+  ReadVector(file, inco_face_dof_mapping_pool);
+
+  inco_face_info_pool.resize(slot_addresses.size());
+  for (size_t i=0; i<inco_face_info_pool.size(); ++i)
+  {
+    inco_face_info_pool[i].slot_address = slot_addresses[i];
+    inco_face_info_pool[i].upwind_dof_mapping =
+      inco_face_dof_mapping_pool.data() + mapping_offsets[i];
+  }
+
+  so_cell_inco_face_dof_indices.reserve(info_offsets.size());
+  for (uint64_t offset : info_offsets)
+    so_cell_inco_face_dof_indices.push_back(
+      inco_face_info_pool.data() + offset);
+
+  ReadVector(file, nonlocal_outb_face_deplocI_slot);
+
+  //================================================== Beta elements
+  ReadFaceMappings(file, nonlocal_inc_face_prelocI_slot_dof);
+  ReadFaceMappings(file, delayed_nonlocal_inc_face_prelocI_slot_dof);
+
+  //================================================== Group strides
+  local_psi_Gn_block_strideG.resize(num_face_categories,0);
+  for (size_t fc=0; fc<num_face_categories; ++fc)
+    local_psi_Gn_block_strideG[fc] = local_psi_n_block_stride[fc] * G;
+  delayed_local_psi_Gn_block_stride  = largest_face*delayed_local_psi_max_elements;
+  delayed_local_psi_Gn_block_strideG = delayed_local_psi_Gn_block_stride*G;
+}
@@ -0,0 +1,178 @@
+#include "message_aggregator.h"
+
+#include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+
+extern ChiLog&     chi_log;
+extern ChiMPI&      chi_mpi;
+
+//###################################################################
+/**Constructor. The flush threshold is in bytes.*/
+chi_mesh::sweep_management::SweepMessageAggregator::
+SweepMessageAggregator(size_t in_flush_threshold,
+                       ChiMPICommunicatorSet* in_comm_set) :
+  flush_threshold(in_flush_threshold),
+  comm_set(in_comm_set)
+{}
+
+//###################################################################
+/**Destructor. Frees the requests of packs still in flight.*/
+chi_mesh::sweep_management::SweepMessageAggregator::
+~SweepMessageAggregator()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (not finalized)
+    for (auto& pack : in_flight)
+      if (pack.request != MPI_REQUEST_NULL)
+        MPI_Request_free(&pack.request);
+}
+
+//###################################################################
+/**Registers the anglesets, indexed by angleset number, and sets the
+ * message tag. max_num_messages is the globally reconciled maximum
+ * message count of the sweep buffers. Since angleset messages use tags
+ * max_num_messages*angle_set_num + m, the first tag past the last
+ * angleset is free for aggregated packs.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::
+Initialize(const std::vector<AngleSet*>& in_angle_sets,
+           int max_num_messages)
+{
+  angle_sets = in_angle_sets;
+  tag = max_num_messages*static_cast<int>(angle_sets.size());
+
+  int* tag_ub = nullptr;
+  int  flag   = 0;
+  MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &tag_ub, &flag);
+  if (flag and tag > *tag_ub)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepMessageAggregator: Message tag " << tag
+      << " exceeds MPI_TAG_UB=" << *tag_ub << ". Increase the "
+      << "sweep eager limit or reduce the number of anglesets.";
+    exit(EXIT_FAILURE);
+  }
+}
+
+//###################################################################
+/**Appends a message to the pack of the destination location. The pack
+ * is sent once it exceeds the flush threshold.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::
+Enqueue(int locJ, int angle_set_num, int message_num,
+        const double* data, size_t size)
+{
+  auto& pack = pack_buffers[locJ];
+
+  pack.push_back(angle_set_num);
+  pack.push_back(message_num);
+  pack.push_back(static_cast<double>(size));
+  pack.insert(pack.end(), data, data + size);
+  ++num_records_sent;
+
+  if (pack.size()*sizeof(double) >= flush_threshold)
+    SendPack(locJ);
+}
+
+//###################################################################
+/**Sends the pack of a destination location.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::SendPack(int locJ)
+{
+  auto& pack = pack_buffers[locJ];
+  if (pack.empty()) return;
+
+  in_flight.emplace_back();
+  auto& flight = in_flight.back();
+  flight.data.swap(pack);
+
+  MPI_Isend(flight.data.data(),
+            static_cast<int>(flight.data.size()),
+            MPI_DOUBLE,
+            comm_set->MapIonJ(locJ,locJ),
+            tag,
+            comm_set->communicators[locJ],
+            &flight.request);
+
+  ++num_messages_sent;
+  num_bytes_sent += flight.data.size()*sizeof(double);
+}
+
+//###################################################################
+/**Sends all non-empty packs. Called at the end of a scheduling step.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::Flush()
+{
+  for (auto& dest_pack : pack_buffers)
+    SendPack(dest_pack.first);
+}
+
+//###################################################################
+/**Receives all available packs and delivers their records to the
+ * addressed anglesets.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::ReceivePacks()
+{
+  MPI_Comm comm = comm_set->communicators[chi_mpi.location_id];
+  MPI_Group comm_group = comm_set->location_groups[chi_mpi.location_id];
+
+  while (true)
+  {
+    int msg_avail = 0;
+    MPI_Status status;
+    MPI_Iprobe(MPI_ANY_SOURCE, tag, comm, &msg_avail, &status);
+    if (not msg_avail) break;
+
+    int count = 0;
+    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    receive_buffer.resize(count);
+
+    MPI_Recv(receive_buffer.data(), count, MPI_DOUBLE,
+             status.MPI_SOURCE, tag, comm, MPI_STATUS_IGNORE);
+
+    int locJ = 0;
+    MPI_Group_translate_ranks(comm_group, 1, &status.MPI_SOURCE,
+                              comm_set->world_group, &locJ);
+
+    //============================== Unpack records
+    size_t k = 0;
+    while (k < receive_buffer.size())
+    {
+      int    angle_set_num = static_cast<int>(receive_buffer[k]);
+      int    message_num   = static_cast<int>(receive_buffer[k+1]);
+      size_t size          = static_cast<size_t>(receive_buffer[k+2]);
+      k += RECORD_HEADER_SIZE;
+
+      angle_sets.at(angle_set_num)->
+        DeliverMessage(angle_set_num, locJ, message_num,
+                       &receive_buffer[k], size);
+      k += size;
+    }
+  }
+}
+
+//###################################################################
+/**Advances aggregated communication: flushes all packs, releases
+ * completed sends and receives available packs.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::Progress()
+{
+  Flush();
+
+  for (auto it = in_flight.begin(); it != in_flight.end();)
+  {
+    int done = 0;
+    MPI_Test(&it->request, &done, MPI_STATUS_IGNORE);
+    if (done) it = in_flight.erase(it);
+    else      ++it;
+  }
+
+  ReceivePacks();
+}
+
+//###################################################################
+/**Returns true when no pack is waiting or in flight.*/
+bool chi_mesh::sweep_management::SweepMessageAggregator::SendsComplete()
+{
+  for (auto& dest_pack : pack_buffers)
+    if (not dest_pack.second.empty()) return false;
+
+  return in_flight.empty();
+}
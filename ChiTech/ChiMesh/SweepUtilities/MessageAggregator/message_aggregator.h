@@ -0,0 +1,78 @@
+#ifndef CHI_SWEEP_MESSAGE_AGGREGATOR_H
+#define CHI_SWEEP_MESSAGE_AGGREGATOR_H
+
+#include "ChiMesh/SweepUtilities/sweep_namespace.h"
+#include <chi_mpi.h>
+
+#include <map>
+#include <list>
+
+namespace chi_mesh::sweep_management
+{
+  class SweepMessageAggregator;
+}
+
+//###################################################################
+/**Coalesces the outgoing angular fluxes of all the anglesets of an
+ * angle aggregation that are destined for the same location.
+ *
+ * Anglesets enqueue their messages instead of sending them. Each
+ * destination has a pack buffer holding records of the form
+ * [angleset number, message number, message size, data...]. A pack is
+ * sent when it exceeds the flush threshold or at the end of a scheduling
+ * step (see Progress()). Incoming packs are received, unpacked and
+ * delivered to the sweep buffers of the addressed anglesets.*/
+class chi_mesh::sweep_management::SweepMessageAggregator
+{
+private:
+  static constexpr int RECORD_HEADER_SIZE = 3;
+
+  const size_t                 flush_threshold; ///< In bytes
+  ChiMPICommunicatorSet* const comm_set;
+
+  std::vector<AngleSet*>       angle_sets; ///< Indexed by angleset number
+  int                          tag = 0;
+
+  std::map<int,std::vector<double>> pack_buffers; ///< Per destination
+
+  struct InFlightPack
+  {
+    std::vector<double> data;
+    MPI_Request         request = MPI_REQUEST_NULL;
+  };
+  std::list<InFlightPack>      in_flight;
+
+  std::vector<double>          receive_buffer;
+
+  //Statistics
+  size_t num_messages_sent = 0;
+  size_t num_bytes_sent    = 0;
+  size_t num_records_sent  = 0;
+
+public:
+  SweepMessageAggregator(size_t in_flush_threshold,
+                         ChiMPICommunicatorSet* in_comm_set);
+  ~SweepMessageAggregator();
+
+  SweepMessageAggregator(const SweepMessageAggregator&) = delete;
+  SweepMessageAggregator& operator=(const SweepMessageAggregator&) = delete;
+
+  void Initialize(const std::vector<AngleSet*>& in_angle_sets,
+                  int max_num_messages);
+
+  void Enqueue(int locJ, int angle_set_num, int message_num,
+               const double* data, size_t size);
+  void Flush();
+  void Progress();
+  bool SendsComplete();
+
+  size_t GetNumMessagesSent() const {return num_messages_sent;}
+  size_t GetNumBytesSent()    const {return num_bytes_sent;}
+  size_t GetNumRecordsSent()  const {return num_records_sent;}
+
+private:
+  void SendPack(int locJ);
+  void ReceivePacks();
+};
+
+#endif
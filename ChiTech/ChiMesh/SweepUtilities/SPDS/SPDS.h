@@ -4,6 +4,7 @@
 #include "ChiMesh/SweepUtilities/SPLS/SPLS.h"
 
 #include <memory>
+#include <iostream>
 
 namespace chi_mesh::sweep_management
 {
@@ -40,6 +41,11 @@ struct chi_mesh::sweep_management::SPDS
   int MapLocJToDeplocI(int locJ);
 
   void BuildTaskDependencyGraph(bool cycle_allowance_flag);
+
+  void ReorderLevelTiesForMemory();
+
+  void Serialize(std::ostream& file) const;
+  void Deserialize(std::istream& file);
 };
 
 #endif
\ No newline at end of file
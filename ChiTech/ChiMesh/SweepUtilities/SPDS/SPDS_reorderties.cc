@@ -0,0 +1,77 @@
+#include "SPDS.h"
+
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_log.h"
+
+extern ChiLog& chi_log;
+
+#include <algorithm>
+#include <set>
+
+//###################################################################
+/**Reorders the cells within each level of the local sweep ordering to
+ * lower the number of face dofs held in flight by the FLUDS.
+ *
+ * Cells of a level do not depend on one another, hence any order within
+ * a level is a valid sweep ordering and the live face dofs at the start
+ * of a level do not depend on it. Each cell releases the slots of its
+ * local incoming faces and occupies slots for its local outgoing faces.
+ * Sweeping the cells of a level in ascending order of this net change
+ * minimizes the peak within the level.
+ *
+ * Must be called before any FLUDS is built on this SPDS. Has no effect
+ * on FLUDS built with concurrent levels since they only release slots
+ * at the end of a level.*/
+void chi_mesh::sweep_management::SPDS::ReorderLevelTiesForMemory()
+{
+  auto& item_id = spls.item_id;
+  auto& levels  = spls.levels;
+  if (levels.empty()) return;
+
+  std::set<std::pair<int,int>> cyclic_pairs;
+  for (const auto& dependency : local_cyclic_dependencies)
+  {
+    cyclic_pairs.insert(dependency);
+    cyclic_pairs.insert({dependency.second,dependency.first});
+  }
+
+  //============================================= Net face dof change
+  std::vector<long long> net_face_dofs(item_id.size(),0);
+  for (int c : item_id)
+  {
+    const auto& cell = grid->local_cells[c];
+    long long net = 0;
+    for (const auto& face : cell.faces)
+    {
+      if (not face.IsNeighborLocal(*grid)) continue;
+
+      int neighbor = face.GetNeighborLocalID(*grid);
+      if (cyclic_pairs.count({c,neighbor}) > 0) continue;
+
+      size_t face_categ = grid->MapFaceHistogramBins(face.vertex_ids.size());
+      auto face_dofs =
+        static_cast<long long>(grid->GetFaceHistogramBinDOFSize(face_categ));
+
+      double mu = omega.Dot(face.normal);
+      if      (mu >= (0.0+1.0e-16)) net += face_dofs;
+      else if (mu <  (0.0-1.0e-16)) net -= face_dofs;
+    }
+    net_face_dofs[c] = net;
+  }
+
+  //============================================= Sort each level
+  auto Compare = [&net_face_dofs](int a, int b)
+  {return net_face_dofs[a] < net_face_dofs[b];};
+
+  int level_begin = 0;
+  for (int level_end : levels)
+  {
+    std::stable_sort(item_id.begin() + level_begin,
+                     item_id.begin() + level_end, Compare);
+    level_begin = level_end;
+  }
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "Reordered " << levels.size() << " sweep levels for FLUDS memory.";
+}
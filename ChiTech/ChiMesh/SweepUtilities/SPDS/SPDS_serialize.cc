@@ -0,0 +1,69 @@
+#include "SPDS.h"
+
+#include "ChiMesh/SweepUtilities/SweepPlan/sweep_plan_io.h"
+
+//###################################################################
+/**Writes the sweep ordering and the location dependencies to a binary
+ * sweep-plan stream. The grid is not written.*/
+void chi_mesh::sweep_management::SPDS::Serialize(std::ostream& file) const
+{
+  using namespace plan_io;
+
+  Write(file, polar);
+  Write(file, azimuthal);
+  Write(file, omega.x);
+  Write(file, omega.y);
+  Write(file, omega.z);
+
+  WriteVector(file, spls.item_id);
+  WriteVector(file, spls.levels);
+
+  Write(file, static_cast<uint64_t>(global_sweep_planes.size()));
+  for (const auto& sweep_plane : global_sweep_planes)
+    WriteVector(file, sweep_plane.item_id);
+
+  WriteVector(file, location_dependencies);
+  WriteVector(file, location_successors);
+  WriteVector(file, delayed_location_dependencies);
+  WriteVector(file, delayed_location_successors);
+  WriteVector(file, local_cyclic_dependencies);
+
+  Write(file, static_cast<uint64_t>(global_dependencies.size()));
+  for (const auto& dependencies : global_dependencies)
+    WriteVector(file, dependencies);
+}
+
+//###################################################################
+/**Reads a sweep ordering written by Serialize. The grid must be set by
+ * the caller.*/
+void chi_mesh::sweep_management::SPDS::Deserialize(std::istream& file)
+{
+  using namespace plan_io;
+
+  Read(file, polar);
+  Read(file, azimuthal);
+  Read(file, omega.x);
+  Read(file, omega.y);
+  Read(file, omega.z);
+
+  ReadVector(file, spls.item_id);
+  ReadVector(file, spls.levels);
+
+  uint64_t num_sweep_planes = 0;
+  Read(file, num_sweep_planes);
+  global_sweep_planes.resize(num_sweep_planes);
+  for (auto& sweep_plane : global_sweep_planes)
+    ReadVector(file, sweep_plane.item_id);
+
+  ReadVector(file, location_dependencies);
+  ReadVector(file, location_successors);
+  ReadVector(file, delayed_location_dependencies);
+  ReadVector(file, delayed_location_successors);
+  ReadVector(file, local_cyclic_dependencies);
+
+  uint64_t num_locations = 0;
+  Read(file, num_locations);
+  global_dependencies.resize(num_locations);
+  for (auto& dependencies : global_dependencies)
+    ReadVector(file, dependencies);
+}
@@ -8,6 +8,11 @@
 struct chi_mesh::sweep_management::SPLS
 {
   std::vector<int> item_id;
+  /**Wavefront levels of the local task-dependency graph. Each level is a
+   * contiguous range of item_id and holds cells without dependencies on
+   * one another. levels[k] is the sweep-order index one-past the last cell
+   * of level k.*/
+  std::vector<int> levels;
 };
 
 //###################################################################
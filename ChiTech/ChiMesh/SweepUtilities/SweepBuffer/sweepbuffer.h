@@ -4,6 +4,9 @@
 #include "ChiMesh/SweepUtilities/sweep_namespace.h"
 #include <chi_mpi.h>
 
+#include <chrono>
+#include <tuple>
+
 //#ifndef FLAG_FINISHED
 //  #define FLAG_FINISHED     true
 //  #define FLAG_NOT_FINISHED false
@@ -50,7 +53,43 @@ private:
 
   std::vector<std::vector<MPI_Request>> deplocI_message_request;
 
-
+  //Pre-posted receives. Upstream receives are posted on the first poll
+  //of each sweep. Delayed receives are persistent since their buffers
+  //live for the duration of the solve.
+  std::vector<MPI_Request>         prelocI_message_request;
+  std::vector<std::pair<int,int>>  prelocI_message_index; ///< (prelocI,m)
+  size_t                           prelocI_num_received = 0;
+
+  std::vector<MPI_Request>         delayed_prelocI_message_request;
+  std::vector<std::pair<int,int>>  delayed_prelocI_message_index;
+  size_t                           delayed_prelocI_num_received = 0;
+  bool                             delayed_requests_initialized = false;
+  bool                             delayed_requests_started = false;
+  bool                             delayed_data_processed = false;
+
+  //Upstream wait time
+  std::chrono::steady_clock::time_point wait_start;
+  double                                wait_time = 0.0;
+  bool                                  wait_recorded = false;
+
+  //Message aggregation. When set, outgoing messages are handed to the
+  //aggregator and incoming messages are delivered by it.
+  SweepMessageAggregator* aggregator = nullptr;
+  ///Messages delivered ahead of the sweep they belong to (locJ,m,data)
+  std::vector<std::tuple<int,int,std::vector<double>>> stashed_messages;
+
+  //Statistics of directly sent messages
+  size_t num_messages_sent = 0;
+  size_t num_bytes_sent    = 0;
+
+  //Non-local and delayed psi buffers carved from the angleset arena
+  bool psi_buffers_allocated = false;
+
+  void AllocatePsiBuffers();
+  void InitializeUpstreamData(int angle_set_num);
+  void PostUpstreamReceives(int angle_set_num);
+  void StartDelayedReceives(int angle_set_num);
+  void FreeDelayedRequests();
 
 public:
   int max_num_mess;
@@ -58,16 +97,27 @@ public:
   SweepBuffer(chi_mesh::sweep_management::AngleSet* ref_angleset,
               int sweep_eager_limit,
               ChiMPICommunicatorSet* in_comm_set);
+  ~SweepBuffer();
+  SweepBuffer(const SweepBuffer&) = delete;
+  SweepBuffer& operator=(const SweepBuffer&) = delete;
   bool DoneSending();
   void BuildMessageStructure();
   void InitializeDelayedUpstreamData();
   void InitializeLocalAndDownstreamBuffers();
   void SendDownstreamPsi(int angle_set_num);
-  void ReceiveDelayedData(int angle_set_num);
+  AngleSetStatus ReceiveDelayedData(int angle_set_num);
   void ClearDownstreamBuffers();
   AngleSetStatus ReceiveUpstreamPsi(int angle_set_num);
   void ClearLocalAndReceiveBuffers();
   void Reset();
+  double GetWaitTime() const {return wait_time;}
+
+  void SetMessageAggregator(SweepMessageAggregator* in_aggregator)
+  {aggregator = in_aggregator;}
+  void DeliverMessage(int angle_set_num, int locJ, int message_num,
+                      const double* data, size_t size);
+  size_t GetNumMessagesSent() const {return num_messages_sent;}
+  size_t GetNumBytesSent()    const {return num_bytes_sent;}
 
 };
 }
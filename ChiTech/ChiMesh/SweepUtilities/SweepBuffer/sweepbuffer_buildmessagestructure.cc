@@ -83,6 +83,13 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
     prelocI_message_available.emplace_back(message_count,false);
   }
 
+  prelocI_message_index.clear();
+  for (size_t prelocI=0; prelocI<num_dependencies; prelocI++)
+    for (int m=0; m<prelocI_message_count[prelocI]; m++)
+      prelocI_message_index.emplace_back(prelocI,m);
+  prelocI_message_request.assign(prelocI_message_index.size(),
+                                 MPI_REQUEST_NULL);
+
   //============================================= Delayed Predecessor locations
   size_t num_delayed_dependencies = spds->delayed_location_dependencies.size();
 
@@ -130,6 +137,12 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
     delayed_prelocI_message_available.emplace_back(message_count,false);
   }
 
+  FreeDelayedRequests();
+  delayed_prelocI_message_index.clear();
+  for (size_t prelocI=0; prelocI<num_delayed_dependencies; prelocI++)
+    for (int m=0; m<delayed_prelocI_message_count[prelocI]; m++)
+      delayed_prelocI_message_index.emplace_back(prelocI,m);
+
 
   //============================================= Successor locations
   size_t num_successors = spds->location_successors.size();
@@ -181,7 +194,7 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
     }
 
     deplocI_message_sent.emplace_back(message_count,false);
-    deplocI_message_request.emplace_back(message_count,MPI_Request());
+    deplocI_message_request.emplace_back(message_count,MPI_REQUEST_NULL);
   }
 
   angleset->fluds->SetReferencePsi(&angleset->local_psi,
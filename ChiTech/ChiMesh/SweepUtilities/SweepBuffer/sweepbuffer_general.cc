@@ -20,6 +20,13 @@ SweepBuffer(chi_mesh::sweep_management::AngleSet* ref_angleset,
   max_num_mess = 0;
 }
 
+//###################################################################
+/**Destructor. Frees persistent requests.*/
+chi_mesh::sweep_management::SweepBuffer::~SweepBuffer()
+{
+  FreeDelayedRequests();
+}
+
 //###################################################################
 /**Returns the private flag done_sending.*/
 bool chi_mesh::sweep_management::SweepBuffer::DoneSending()
@@ -33,11 +40,8 @@ bool chi_mesh::sweep_management::SweepBuffer::DoneSending()
 void chi_mesh::sweep_management::SweepBuffer::
 ClearLocalAndReceiveBuffers()
 {
-  auto empty_vector = std::vector<std::vector<double>>(0);
-  angleset->local_psi.swap(empty_vector);
-
-  empty_vector = std::vector<std::vector<double>>(0);
-  angleset->prelocI_outgoing_psi.swap(empty_vector);
+  //The views are released, the storage stays with the arenas
+  angleset->local_psi.clear();
 }
 
 //###################################################################
@@ -53,23 +57,10 @@ ClearDownstreamBuffers()
   for (size_t deplocI=0; deplocI<spds->location_successors.size(); deplocI++)
   {
     int num_mess = deplocI_message_count[deplocI];
-    for (int m=0; m<num_mess; m++)
-    {
-      int  send_request_status = 1;
-      MPI_Test(&deplocI_message_request[deplocI][m],
-               &send_request_status,MPI_STATUS_IGNORE);
-      if (send_request_status == 0) done_sending = false;
-    }
-
-  }
-
-  if (done_sending)
-  {
-    for (size_t deplocI=0; deplocI<spds->location_successors.size(); deplocI++)
-    {
-      angleset->deplocI_outgoing_psi[deplocI].clear();
-      angleset->deplocI_outgoing_psi[deplocI].shrink_to_fit();
-    }
+    int send_request_status = 1;
+    MPI_Testall(num_mess, deplocI_message_request[deplocI].data(),
+                &send_request_status, MPI_STATUSES_IGNORE);
+    if (send_request_status == 0) done_sending = false;
   }
 }
 
@@ -80,6 +71,12 @@ void chi_mesh::sweep_management::SweepBuffer::Reset()
   done_sending = false;
   data_initialized = false;
   upstream_data_initialized = false;
+  prelocI_num_received = 0;
+  wait_recorded = false;
+
+  delayed_requests_started = false;
+  delayed_data_processed = false;
+  delayed_prelocI_num_received = 0;
 
   for (int prelocI=0; prelocI<prelocI_message_available.size(); prelocI++)
     for (int m=0; m<prelocI_message_available[prelocI].size(); m++)
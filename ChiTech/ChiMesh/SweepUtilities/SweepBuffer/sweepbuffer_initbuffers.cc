@@ -14,37 +14,32 @@ extern ChiLog& chi_log;
 /** This is the final level of initialization before a sweep-chunk executes.
  * Once all upstream dependencies are met and if the sweep scheduler places
  * this angleset as "ready-to-execute", then the angle-set will call this
- * method. It is also fairly important in terms of memory to only allocate
- * these chunks of memory since they form the majority of memory requirements.*/
+ * method. The local psi buffers form the majority of memory requirements,
+ * hence they are carved from an arena shared by all anglesets that never
+ * execute concurrently.*/
 void chi_mesh::sweep_management::SweepBuffer::
 InitializeLocalAndDownstreamBuffers()
 {
   if (!data_initialized)
   {
-    auto spds =  angleset->GetSPDS();
     auto fluds=  angleset->fluds;
 
-    int num_grps   = angleset->GetNumGrps();
-    int num_angles = angleset->angles.size();
+    u_ll_int num_grps   = angleset->GetNumGrps();
+    u_ll_int num_angles = angleset->angles.size();
 
-    //============================ Resize FLUDS local outgoing Data
-    angleset->local_psi.resize(fluds->num_face_categories);
+    //============================ Carve FLUDS local outgoing Data
     // fc = face category
+    std::vector<size_t> local_psi_sizes(fluds->num_face_categories);
     for (size_t fc = 0; fc<fluds->num_face_categories; fc++)
-    {
-      angleset->local_psi[fc].resize(fluds->local_psi_stride[fc]*
-                                     fluds->local_psi_max_elements[fc]*
-                                     num_grps*num_angles,0.0);
-    }
-
-    //============================ Resize FLUDS non-local outgoing Data
-    angleset->deplocI_outgoing_psi.resize(
-      spds->location_successors.size(),std::vector<double>());
-    for (size_t deplocI=0; deplocI<spds->location_successors.size(); deplocI++)
-    {
-      angleset->deplocI_outgoing_psi[deplocI].resize(
-        fluds->deplocI_face_dof_count[deplocI]*num_grps*num_angles,0.0);
-    }
+      local_psi_sizes[fc] = fluds->local_psi_stride[fc]*
+                            fluds->local_psi_max_elements[fc]*
+                            num_grps*num_angles;
+
+    angleset->local_psi = angleset->local_psi_arena->Carve(local_psi_sizes);
+
+    //============================ Reset FLUDS non-local outgoing Data
+    for (auto& psi : angleset->deplocI_outgoing_psi)
+      psi.Zero();
 
     //================================================ Make a memory query
     double memory_mb = chi_console.GetMemoryUsageInMB();
@@ -6,40 +6,79 @@
 
 //###################################################################
 /**Initializes delayed upstream data. This method gets called
- * when a sweep scheduler is constructed.*/
+ * when a sweep scheduler is constructed. On the first call all the
+ * non-local and delayed psi buffers of the angleset are carved from its
+ * arena, thereafter only the delayed non-local buffers are reset.*/
 void chi_mesh::sweep_management::SweepBuffer::
 InitializeDelayedUpstreamData()
+{
+  //Persistent receives refer to the buffers being reset here
+  FreeDelayedRequests();
+
+  if (not psi_buffers_allocated)
+  {
+    AllocatePsiBuffers();
+    return;
+  }
+
+  for (auto& psi : angleset->delayed_prelocI_outgoing_psi)     psi.Zero();
+  for (auto& psi : angleset->delayed_prelocI_outgoing_psi_old) psi.Zero();
+}
+
+//###################################################################
+/**Carves all the non-local and delayed psi buffers of the angleset from
+ * a single arena. The arena is laid out as
+ * [delayed local, delayed local old,
+ *  delayed prelocI..., delayed prelocI old...,
+ *  prelocI..., deplocI...].*/
+void chi_mesh::sweep_management::SweepBuffer::AllocatePsiBuffers()
 {
   auto  spds =  angleset->GetSPDS();
-  auto fluds=  angleset->fluds;
+  auto fluds =  angleset->fluds;
 
-  int num_grps   = angleset->GetNumGrps();
-  int num_angles = angleset->angles.size();
+  u_ll_int num_grps   = angleset->GetNumGrps();
+  u_ll_int num_angles = angleset->angles.size();
+  u_ll_int GN         = num_grps*num_angles;
 
-  angleset->delayed_prelocI_outgoing_psi.clear();
-  angleset->delayed_prelocI_outgoing_psi.resize(
-    spds->delayed_location_dependencies.size());
+  size_t num_delayed_deps = spds->delayed_location_dependencies.size();
+  size_t num_deps         = spds->location_dependencies.size();
+  size_t num_succs        = spds->location_successors.size();
 
-  angleset->delayed_prelocI_outgoing_psi_old.clear();
-  angleset->delayed_prelocI_outgoing_psi_old.resize(
-    spds->delayed_location_dependencies.size());
+  //============================================= Buffer sizes
+  std::vector<size_t> buffer_sizes;
+  u_ll_int delayed_local_size = fluds->delayed_local_psi_stride*
+                                fluds->delayed_local_psi_max_elements*GN;
+  buffer_sizes.push_back(delayed_local_size);
+  buffer_sizes.push_back(delayed_local_size);
 
-  for (int prelocI=0;
-       prelocI<spds->delayed_location_dependencies.size(); prelocI++)
-  {
-    int num_dofs = fluds->delayed_prelocI_face_dof_count[prelocI];
+  for (int copy=0; copy<2; copy++)
+    for (size_t prelocI=0; prelocI<num_delayed_deps; prelocI++)
+      buffer_sizes.push_back(fluds->delayed_prelocI_face_dof_count[prelocI]*GN);
 
-    u_ll_int buff_size = num_dofs*num_grps*num_angles;
+  for (size_t prelocI=0; prelocI<num_deps; prelocI++)
+    buffer_sizes.push_back(fluds->prelocI_face_dof_count[prelocI]*GN);
 
-    angleset->delayed_prelocI_outgoing_psi[prelocI].resize(buff_size,0.0);
-    angleset->delayed_prelocI_outgoing_psi_old[prelocI].resize(buff_size,0.0);
-  }
+  for (size_t deplocI=0; deplocI<num_succs; deplocI++)
+    buffer_sizes.push_back(fluds->deplocI_face_dof_count[deplocI]*GN);
+
+  //============================================= Carve
+  auto buffers = angleset->psi_arena.Carve(buffer_sizes);
+  auto buffer  = buffers.begin();
+
+  angleset->delayed_local_psi     = *buffer++;
+  angleset->delayed_local_psi_old = *buffer++;
+
+  angleset->delayed_prelocI_outgoing_psi.assign(buffer,
+                                                buffer + num_delayed_deps);
+  buffer += num_delayed_deps;
+  angleset->delayed_prelocI_outgoing_psi_old.assign(buffer,
+                                                    buffer + num_delayed_deps);
+  buffer += num_delayed_deps;
+
+  angleset->prelocI_outgoing_psi.assign(buffer, buffer + num_deps);
+  buffer += num_deps;
 
-  angleset->delayed_local_psi.resize(fluds->delayed_local_psi_stride*
-                           fluds->delayed_local_psi_max_elements*
-                           num_grps*num_angles,0.0);
+  angleset->deplocI_outgoing_psi.assign(buffer, buffer + num_succs);
 
-  angleset->delayed_local_psi_old.resize(fluds->delayed_local_psi_stride*
-                                         fluds->delayed_local_psi_max_elements*
-                                         num_grps*num_angles,0.0);
-}
\ No newline at end of file
+  psi_buffers_allocated = true;
+}
@@ -6,91 +6,138 @@
 #include <chi_log.h>
 #include <chi_mpi.h>
 
+#include <sstream>
+
 extern ChiLog&     chi_log;
 extern ChiMPI&      chi_mpi;
 
 //###################################################################
-/** Receives delayed data from successor locations. */
+/**Starts the persistent receives of delayed data. The requests are
+ * created on first use since the message tags depend on the globally
+ * reconciled maximum message count.*/
 void chi_mesh::sweep_management::SweepBuffer::
+StartDelayedReceives(int angle_set_num)
+{
+  if (delayed_prelocI_message_index.empty()) return;
+
+  auto spds = angleset->GetSPDS();
+
+  if (!delayed_requests_initialized)
+  {
+    delayed_prelocI_message_request.assign(
+      delayed_prelocI_message_index.size(), MPI_REQUEST_NULL);
+
+    for (size_t k=0; k<delayed_prelocI_message_index.size(); k++)
+    {
+      int prelocI = delayed_prelocI_message_index[k].first;
+      int m       = delayed_prelocI_message_index[k].second;
+      int locJ    = spds->delayed_location_dependencies[prelocI];
+
+      u_ll_int block_addr   = delayed_prelocI_message_blockpos[prelocI][m];
+      u_ll_int message_size = delayed_prelocI_message_size[prelocI][m];
+
+      MPI_Recv_init(
+        &angleset->delayed_prelocI_outgoing_psi[prelocI].data()[block_addr],
+        message_size,
+        MPI_DOUBLE,
+        comm_set->MapIonJ(locJ,chi_mpi.location_id),
+        max_num_mess*angle_set_num + m, //tag
+        comm_set->communicators[chi_mpi.location_id],
+        &delayed_prelocI_message_request[k]);
+    }
+    delayed_requests_initialized = true;
+  }
+
+  MPI_Startall(delayed_prelocI_message_request.size(),
+               delayed_prelocI_message_request.data());
+  delayed_requests_started = true;
+}
+
+//###################################################################
+/**Frees the persistent delayed data requests. These must not be
+ * active.*/
+void chi_mesh::sweep_management::SweepBuffer::FreeDelayedRequests()
+{
+  if (delayed_requests_initialized)
+  {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (not finalized)
+      for (auto& request : delayed_prelocI_message_request)
+        if (request != MPI_REQUEST_NULL)
+          MPI_Request_free(&request);
+  }
+  delayed_prelocI_message_request.clear();
+  delayed_requests_initialized = false;
+  delayed_requests_started = false;
+}
+
+//###################################################################
+/** Receives delayed data from successor locations. Returns
+ * AngleSetStatus::RECEIVING while delayed messages are outstanding.
+ * Once all of them have arrived the change norms are computed and the
+ * new data is copied to the lagged buffers, exactly once per sweep.
+ * Waiting on these point-to-point messages makes a global barrier at
+ * the end of the sweep unnecessary.*/
+chi_mesh::sweep_management::AngleSetStatus
+chi_mesh::sweep_management::SweepBuffer::
 ReceiveDelayedData(int angle_set_num)
 {
+  if (delayed_data_processed) return AngleSetStatus::FINISHED;
+
   auto spds =  angleset->GetSPDS();
 
   //======================================== Receive delayed data
-  for (size_t prelocI=0; prelocI<spds->delayed_location_dependencies.size(); prelocI++)
+  if (aggregator == nullptr and !delayed_requests_started)
+    StartDelayedReceives(angle_set_num);
+
+  size_t num_requests = delayed_prelocI_message_index.size();
+  if (aggregator == nullptr and delayed_prelocI_num_received < num_requests)
   {
-    int locJ = spds->delayed_location_dependencies[prelocI];
+    std::vector<int> indices(num_requests);
+    std::vector<MPI_Status> statuses(num_requests);
+    int num_completed = 0;
 
-    std::vector<double> psi_old(angleset->delayed_prelocI_outgoing_psi[prelocI].size(),0.0);
+    int error_code = MPI_Testsome(num_requests,
+                                  delayed_prelocI_message_request.data(),
+                                  &num_completed,
+                                  indices.data(),
+                                  statuses.data());
 
-    for (size_t k=0; k<psi_old.size(); k++)
-      psi_old[k] = angleset->delayed_prelocI_outgoing_psi[prelocI][k];
+    if (error_code != MPI_SUCCESS)
+    {
+      std::stringstream err_stream;
+      err_stream << "################# Delayed receive error."
+                 << " as_num=" << angle_set_num
+                 << " num_mess=" << num_requests
+                 << " error=\n";
+      char error_string[BUFSIZ];
+      int length_of_error_string, error_class;
+      MPI_Error_class(error_code, &error_class);
+      MPI_Error_string(error_class, error_string, &length_of_error_string);
+      err_stream << error_string << "\n";
+      MPI_Error_string(error_code, error_string, &length_of_error_string);
+      err_stream << error_string << "\n";
+      chi_log.Log(LOG_ALLWARNING) << err_stream.str();
+    }
 
-    int num_mess = delayed_prelocI_message_count[prelocI];
-    for (int m=0; m<num_mess; m++)
+    if (num_completed == MPI_UNDEFINED) num_completed = 0;
+    for (int c=0; c<num_completed; c++)
     {
+      const auto& index = delayed_prelocI_message_index[indices[c]];
+      delayed_prelocI_message_available[index.first][index.second] = true;
+    }
+    delayed_prelocI_num_received += num_completed;
+  }
+
+  if (delayed_prelocI_num_received < num_requests)
+    return AngleSetStatus::RECEIVING;
+
+  //================================================ Compute norms
+  for (size_t prelocI=0; prelocI<spds->delayed_location_dependencies.size(); prelocI++)
+  {
+    const auto& psi_old = angleset->delayed_prelocI_outgoing_psi_old[prelocI];
 
-      if (!delayed_prelocI_message_available[prelocI][m])
-      {
-        int msg_avail = 1;
-
-        MPI_Status status0;
-        MPI_Iprobe(comm_set->MapIonJ(locJ,chi_mpi.location_id),
-                   max_num_mess*angle_set_num + m, //tag
-                   comm_set->communicators[chi_mpi.location_id],
-                   &msg_avail,&status0);
-
-//        if (msg_avail != 1)
-//          chi_log.Log(LOG_ALL)
-//            << "SweepBuffer: Delayed Data message was not available";
-
-        if (msg_avail != 1)
-        {
-          break;
-        }//if message is not available
-
-        //============================ Receive upstream data
-        delayed_prelocI_message_available[prelocI][m] = true;
-
-        u_ll_int block_addr   = delayed_prelocI_message_blockpos[prelocI][m];
-        u_ll_int message_size = delayed_prelocI_message_size[prelocI][m];
-
-        MPI_Status status;
-        int error_code =
-          MPI_Recv(&angleset->delayed_prelocI_outgoing_psi[prelocI].data()[block_addr],
-                   message_size,
-                   MPI_DOUBLE,
-                   comm_set->MapIonJ(locJ,chi_mpi.location_id),
-                   max_num_mess*angle_set_num + m, //tag
-                   comm_set->communicators[chi_mpi.location_id],
-                   &status);
-
-        int num = MPI_Get_count(&status,MPI_DOUBLE,&num);
-
-        if (error_code != MPI_SUCCESS)
-        {
-          std::stringstream err_stream;
-          err_stream << "################# Delayed receive error."
-                     << " message size=" << message_size
-                     << " as_num=" << angle_set_num
-                     << " num_mess=" << num_mess
-                     << " m=" << m
-                     << " error=" << status.MPI_ERROR
-                     << " size=" << num << "\n";
-          char error_string[BUFSIZ];
-          int length_of_error_string, error_class;
-          MPI_Error_class(error_code, &error_class);
-          MPI_Error_string(error_class, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          MPI_Error_string(error_code, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          chi_log.Log(LOG_ALLWARNING) << err_stream.str();
-        }
-
-      }//if not message already received
-    }//for message
-
-    //================================================ Compute norms
     double rel_change = 0.0;
     for (size_t k=0; k<psi_old.size(); k++)
     {
@@ -123,13 +170,17 @@ ReceiveDelayedData(int angle_set_num)
   //                                                   to Psi_old
   for (size_t prelocI=0; prelocI<spds->delayed_location_dependencies.size(); prelocI++)
   {
-    auto& psi_new = angleset->delayed_prelocI_outgoing_psi[prelocI];
-    auto& psi_old = angleset->delayed_prelocI_outgoing_psi_old[prelocI];
-    psi_old = psi_new;
+    const auto& psi_new = angleset->delayed_prelocI_outgoing_psi[prelocI];
+    auto&       psi_old = angleset->delayed_prelocI_outgoing_psi_old[prelocI];
+    std::copy(psi_new.begin(), psi_new.end(), psi_old.begin());
   }
 
   //================================================== Copy local delayed Psi
   //                                                   to Psi_old
-  angleset->delayed_local_psi_old = angleset->delayed_local_psi;
+  std::copy(angleset->delayed_local_psi.begin(),
+            angleset->delayed_local_psi.end(),
+            angleset->delayed_local_psi_old.begin());
 
-}
\ No newline at end of file
+  delayed_data_processed = true;
+  return AngleSetStatus::FINISHED;
+}
@@ -7,105 +7,200 @@
 #include <chi_log.h>
 #include <chi_mpi.h>
 
-extern ChiLog     chi_log;
+#include <sstream>
+#include <algorithm>
+
+extern ChiLog&     chi_log;
 extern ChiMPI&      chi_mpi;
 
 //###################################################################
-/**Check if all upstream dependencies have been met and receives
- * it as it becomes available.*/
-chi_mesh::sweep_management::AngleSetStatus
-chi_mesh::sweep_management::SweepBuffer::ReceiveUpstreamPsi(int angle_set_num)
+/**Pre-posts the receives of all upstream messages of this angleset.
+ * Posting the receives before the data arrives allows the MPI library
+ * to deliver it directly into the FLUDS buffers while this location
+ * is busy with other work.*/
+void chi_mesh::sweep_management::SweepBuffer::
+PostUpstreamReceives(int angle_set_num)
+{
+  auto spds = angleset->GetSPDS();
+
+  for (size_t k=0; k<prelocI_message_index.size(); k++)
+  {
+    int prelocI = prelocI_message_index[k].first;
+    int m       = prelocI_message_index[k].second;
+    int locJ    = spds->location_dependencies[prelocI];
+
+    u_ll_int block_addr   = prelocI_message_blockpos[prelocI][m];
+    u_ll_int message_size = prelocI_message_size[prelocI][m];
+
+    MPI_Irecv(&angleset->prelocI_outgoing_psi[prelocI].data()[block_addr],
+              message_size,
+              MPI_DOUBLE,
+              comm_set->MapIonJ(locJ,chi_mpi.location_id),
+              max_num_mess*angle_set_num + m, //tag
+              comm_set->communicators[chi_mpi.location_id],
+              &prelocI_message_request[k]);
+  }
+}
+
+//###################################################################
+/**Resets the upstream receive buffers of a sweep and, unless
+ * messages are aggregated, pre-posts all receives. Messages stashed
+ * during the previous sweep are delivered.*/
+void chi_mesh::sweep_management::SweepBuffer::
+InitializeUpstreamData(int angle_set_num)
 {
-  auto  spds =  angleset->GetSPDS();
-  auto fluds =  angleset->fluds;
+  //============================== Reset FLUDS non-local incoming Data
+  for (auto& psi : angleset->prelocI_outgoing_psi)
+    psi.Zero();
+  prelocI_num_received = 0;
+
+  //============================== Post receives
+  if (aggregator == nullptr)
+  {
+    PostUpstreamReceives(angle_set_num);
+    StartDelayedReceives(angle_set_num);
+  }
+
+  wait_start = std::chrono::steady_clock::now();
+  upstream_data_initialized = true;
+
+  //============================== Deliver stashed messages
+  std::vector<std::tuple<int,int,std::vector<double>>> stash;
+  stash.swap(stashed_messages);
+  for (auto& message : stash)
+  {
+    const auto& data = std::get<2>(message);
+    DeliverMessage(angle_set_num, std::get<0>(message), std::get<1>(message),
+                   data.data(), data.size());
+  }
+}
+
+//###################################################################
+/**Delivers a message, received by the message aggregator, from
+ * location locJ. If the message was already received during the current
+ * sweep then it belongs to the next sweep and is stashed until then.*/
+void chi_mesh::sweep_management::SweepBuffer::
+DeliverMessage(int angle_set_num, int locJ, int message_num,
+               const double* data, size_t size)
+{
+  auto spds = angleset->GetSPDS();
+
+  //============================== Upstream dependency
+  const auto& deps = spds->location_dependencies;
+  auto dep = std::find(deps.begin(), deps.end(), locJ);
+  if (dep != deps.end())
+  {
+    size_t prelocI = dep - deps.begin();
+    if (prelocI_message_available[prelocI][message_num])
+    {
+      stashed_messages.emplace_back(locJ, message_num,
+                                    std::vector<double>(data, data + size));
+      return;
+    }
+
+    if (!upstream_data_initialized) InitializeUpstreamData(angle_set_num);
 
-  int num_grps   = angleset->GetNumGrps();
-  int num_angles = angleset->angles.size();
+    u_ll_int block_addr = prelocI_message_blockpos[prelocI][message_num];
+    std::copy(data, data + size,
+              &angleset->prelocI_outgoing_psi[prelocI].data()[block_addr]);
 
-  //============================== Resize FLUDS non-local incoming Data
-  if (!upstream_data_initialized)
+    prelocI_message_available[prelocI][message_num] = true;
+    ++prelocI_num_received;
+    return;
+  }
+
+  //============================== Delayed upstream dependency
+  const auto& delayed_deps = spds->delayed_location_dependencies;
+  auto delayed_dep = std::find(delayed_deps.begin(), delayed_deps.end(), locJ);
+  if (delayed_dep != delayed_deps.end())
   {
-    angleset->prelocI_outgoing_psi.resize(
-      spds->location_dependencies.size(),std::vector<double>());
-    for (size_t prelocI=0; prelocI<spds->location_dependencies.size(); prelocI++)
+    size_t prelocI = delayed_dep - delayed_deps.begin();
+    if (delayed_prelocI_message_available[prelocI][message_num])
     {
-      angleset->prelocI_outgoing_psi[prelocI].resize(
-        fluds->prelocI_face_dof_count[prelocI]*num_grps*num_angles,0.0);
+      stashed_messages.emplace_back(locJ, message_num,
+                                    std::vector<double>(data, data + size));
+      return;
     }
 
-    upstream_data_initialized = true;
+    u_ll_int block_addr = delayed_prelocI_message_blockpos[prelocI][message_num];
+    std::copy(data, data + size,
+              &angleset->delayed_prelocI_outgoing_psi[prelocI].data()[block_addr]);
+
+    delayed_prelocI_message_available[prelocI][message_num] = true;
+    ++delayed_prelocI_num_received;
+    return;
   }
 
-  //============================== Assume all data is available and now try
-  //                               to receive all of it
-  bool ready_to_execute = true;
-  for (size_t prelocI=0; prelocI<spds->location_dependencies.size(); prelocI++)
+  chi_log.Log(LOG_ALLERROR)
+    << "SweepBuffer: Message delivered from location " << locJ
+    << " which is not an upstream location of angleset " << angle_set_num;
+  exit(EXIT_FAILURE);
+}
+
+//###################################################################
+/**Check if all upstream dependencies have been met and receives
+ * it as it becomes available. On the first call of a sweep the
+ * receive buffers are allocated and all receives are pre-posted,
+ * thereafter completed messages are collected with MPI_Testsome.
+ * With message aggregation the messages are delivered by the
+ * aggregator instead.*/
+chi_mesh::sweep_management::AngleSetStatus
+chi_mesh::sweep_management::SweepBuffer::ReceiveUpstreamPsi(int angle_set_num)
+{
+  if (!upstream_data_initialized) InitializeUpstreamData(angle_set_num);
+
+  //============================== Collect completed messages
+  size_t num_requests = prelocI_message_index.size();
+  if (aggregator == nullptr and prelocI_num_received < num_requests)
   {
-    int locJ = spds->location_dependencies[prelocI];
+    std::vector<int> indices(num_requests);
+    std::vector<MPI_Status> statuses(num_requests);
+    int num_completed = 0;
+
+    int error_code = MPI_Testsome(num_requests,
+                                  prelocI_message_request.data(),
+                                  &num_completed,
+                                  indices.data(),
+                                  statuses.data());
+
+    if (error_code != MPI_SUCCESS)
+    {
+      std::stringstream err_stream;
+      err_stream << "################# Upstream receive error."
+                 << " as_num=" << angle_set_num
+                 << " num_mess=" << num_requests
+                 << " error=\n";
+      char error_string[BUFSIZ];
+      int length_of_error_string, error_class;
+      MPI_Error_class(error_code, &error_class);
+      MPI_Error_string(error_class, error_string, &length_of_error_string);
+      err_stream << error_string << "\n";
+      MPI_Error_string(error_code, error_string, &length_of_error_string);
+      err_stream << error_string << "\n";
+      chi_log.Log(LOG_ALLWARNING) << err_stream.str();
+    }
 
-    size_t num_mess = prelocI_message_count[prelocI];
-    for (size_t m=0; m<num_mess; m++)
+    if (num_completed == MPI_UNDEFINED) num_completed = 0;
+    for (int c=0; c<num_completed; c++)
     {
+      const auto& index = prelocI_message_index[indices[c]];
+      prelocI_message_available[index.first][index.second] = true;
+    }
+    prelocI_num_received += num_completed;
+  }
 
-      if (!prelocI_message_available[prelocI][m])
-      {
-        int msg_avail = 1;
-
-        MPI_Iprobe(comm_set->MapIonJ(locJ,chi_mpi.location_id),
-                   max_num_mess*angle_set_num + m, //tag
-                   comm_set->communicators[chi_mpi.location_id],
-                   &msg_avail,MPI_STATUS_IGNORE);
-
-        if (msg_avail != 1)
-        {
-          ready_to_execute = false;
-          break;
-        }//if message is not available
-
-
-        //============================ Receive upstream data
-        prelocI_message_available[prelocI][m] = true;
-
-        u_ll_int block_addr   = prelocI_message_blockpos[prelocI][m];
-        u_ll_int message_size = prelocI_message_size[prelocI][m];
-
-        int error_code = MPI_Recv(&angleset->prelocI_outgoing_psi[prelocI].data()[block_addr],
-                                  message_size,
-                                  MPI_DOUBLE,
-                                  comm_set->MapIonJ(locJ,chi_mpi.location_id),
-                                  max_num_mess*angle_set_num + m, //tag
-                                  comm_set->communicators[chi_mpi.location_id],
-                                  MPI_STATUS_IGNORE);
-
-        if (error_code != MPI_SUCCESS)
-        {
-          std::stringstream err_stream;
-          err_stream << "################# Delayed receive error."
-                     << " message size=" << message_size
-                     << " as_num=" << angle_set_num
-                     << " num_mess=" << num_mess
-                     << " m=" << m
-                     << " error="
-                     << " size=\n";
-          char error_string[BUFSIZ];
-          int length_of_error_string, error_class;
-          MPI_Error_class(error_code, &error_class);
-          MPI_Error_string(error_class, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          MPI_Error_string(error_code, error_string, &length_of_error_string);
-          err_stream << error_string << "\n";
-          chi_log.Log(LOG_ALLWARNING) << err_stream.str();
-        }
-      }//if not message already received
-    }//for message
-
-    if (!ready_to_execute) break;
-  }//for predecessor
-
-  if (!ready_to_execute)
+  if (prelocI_num_received < num_requests)
     return AngleSetStatus::RECEIVING;
-  else
-    return AngleSetStatus::READY_TO_EXECUTE;
+
+  if (not wait_recorded)
+  {
+    std::chrono::duration<double> wait =
+      std::chrono::steady_clock::now() - wait_start;
+    wait_time += wait.count();
+    wait_recorded = true;
+  }
+
+  return AngleSetStatus::READY_TO_EXECUTE;
 }
 
 ////###################################################################
@@ -2,10 +2,12 @@
 
 #include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
 #include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+#include "ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h"
 
 //###################################################################
 /**Sends downstream psi. This method gets called after a sweep chunk has
- * executed */
+ * executed. With message aggregation the messages are handed to the
+ * aggregator instead.*/
 void chi_mesh::sweep_management::SweepBuffer::
 SendDownstreamPsi(int angle_set_num)
 {
@@ -21,6 +23,18 @@ SendDownstreamPsi(int angle_set_num)
       u_ll_int block_addr   = deplocI_message_blockpos[deplocI][m];
       u_ll_int message_size = deplocI_message_size[deplocI][m];
 
+      if (aggregator != nullptr)
+      {
+        aggregator->Enqueue(
+          locJ, angle_set_num, m,
+          &angleset->deplocI_outgoing_psi[deplocI].data()[block_addr],
+          message_size);
+        continue;
+      }
+
+      ++num_messages_sent;
+      num_bytes_sent += message_size*sizeof(double);
+
       MPI_Isend(&angleset->deplocI_outgoing_psi[deplocI].data()[block_addr],
                 message_size,
                 MPI_DOUBLE,
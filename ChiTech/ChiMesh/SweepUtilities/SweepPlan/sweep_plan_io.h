@@ -0,0 +1,103 @@
+#ifndef CHI_SWEEP_PLAN_IO_H
+#define CHI_SWEEP_PLAN_IO_H
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <utility>
+
+//###################################################################
+/**Binary read and write helpers for sweep-plan files. Values are
+ * stored in native byte order since plans are only valid for the
+ * machine and partition that wrote them.*/
+namespace chi_mesh::sweep_management::plan_io
+{
+  template<typename T>
+  void Write(std::ostream& file, const T& value)
+  {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template<typename T>
+  void Read(std::istream& file, T& value)
+  {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  template<typename T>
+  void WriteVector(std::ostream& file, const std::vector<T>& values)
+  {
+    Write(file, static_cast<uint64_t>(values.size()));
+    file.write(reinterpret_cast<const char*>(values.data()),
+               static_cast<std::streamsize>(values.size()*sizeof(T)));
+  }
+
+  template<typename T>
+  void ReadVector(std::istream& file, std::vector<T>& values)
+  {
+    uint64_t size = 0;
+    Read(file, size);
+    values.resize(size);
+    file.read(reinterpret_cast<char*>(values.data()),
+              static_cast<std::streamsize>(size*sizeof(T)));
+  }
+
+  /**Writes a vector of arrays whose lengths are given separately.*/
+  template<typename T>
+  void WriteArrays(std::ostream& file, const std::vector<T*>& arrays,
+                   const std::vector<uint64_t>& lengths)
+  {
+    WriteVector(file, lengths);
+    for (size_t i=0; i<arrays.size(); ++i)
+      file.write(reinterpret_cast<const char*>(arrays[i]),
+                 static_cast<std::streamsize>(lengths[i]*sizeof(T)));
+  }
+
+  /**Reads arrays written by WriteArrays. The arrays are allocated with
+   * new[], the owner deletes them.*/
+  template<typename T>
+  void ReadArrays(std::istream& file, std::vector<T*>& arrays)
+  {
+    std::vector<uint64_t> lengths;
+    ReadVector(file, lengths);
+    arrays.reserve(lengths.size());
+    for (uint64_t length : lengths)
+    {
+      auto array = new T[length];
+      file.read(reinterpret_cast<char*>(array),
+                static_cast<std::streamsize>(length*sizeof(T)));
+      arrays.push_back(array);
+    }
+  }
+
+  /**Writes [slot, (preloc, dof mapping)] face mappings.*/
+  inline void WriteFaceMappings(
+    std::ostream& file,
+    const std::vector<std::pair<int,std::pair<int,std::vector<int>>>>& mappings)
+  {
+    Write(file, static_cast<uint64_t>(mappings.size()));
+    for (const auto& mapping : mappings)
+    {
+      Write(file, mapping.first);
+      Write(file, mapping.second.first);
+      WriteVector(file, mapping.second.second);
+    }
+  }
+
+  inline void ReadFaceMappings(
+    std::istream& file,
+    std::vector<std::pair<int,std::pair<int,std::vector<int>>>>& mappings)
+  {
+    uint64_t size = 0;
+    Read(file, size);
+    mappings.resize(size);
+    for (auto& mapping : mappings)
+    {
+      Read(file, mapping.first);
+      Read(file, mapping.second.first);
+      ReadVector(file, mapping.second.second);
+    }
+  }
+}
+
+#endif
@@ -5,14 +5,6 @@
 #include "ChiMesh/SweepUtilities/sweepchunk_base.h"
 
 
-namespace chi_mesh::sweep_management
-{
-  enum class SchedulingAlgorithm {
-    FIRST_IN_FIRST_OUT = 1,
-    DEPTH_OF_GRAPH = 2
-  };
-}
-
 typedef chi_mesh::sweep_management::AngleSetGroup TAngleSetGroup;
 typedef chi_mesh::sweep_management::AngleSet      TAngleSet;
 typedef chi_mesh::sweep_management::STDG          TGSPO;
@@ -35,6 +27,8 @@ private:
     int        sign_of_omegay;
     int        sign_of_omegaz;
     size_t     set_index;
+    double     critical_path;    ///< Remaining work from this location
+    int        num_successors;   ///< Downstream locations unblocked
 
     explicit RULE_VALUES(std::shared_ptr<TAngleSet> ref_as) :
       angle_set(ref_as)
@@ -44,9 +38,20 @@ private:
       sign_of_omegax = 1;
       sign_of_omegay = 1;
       sign_of_omegaz = 1;
+      critical_path  = 0.0;
+      num_successors = 0;
     }
   };
   std::vector<RULE_VALUES> rule_values;
+  size_t                   num_sweeps = 0;
+
+  //Communication statistics at construction. Anglesets accumulate their
+  //statistics over their lifetime, which may span several schedulers.
+  double                   initial_wait_time = 0.0;
+  std::pair<size_t,size_t> initial_messages_sent = {0,0};
+
+  //Critical path algorithm
+  double                   predicted_efficiency = 0.0;
 public:
   const size_t sweep_event_tag;
   const std::vector<size_t> sweep_timing_events_tag;
@@ -57,13 +62,24 @@ public:
   void Sweep(SweepChunk* in_sweep_chunk=NULL);
   double GetAverageSweepTime();
   std::vector<double> GetAngleSetTimings();
+  std::vector<double> GetAngleSetWaitTimes();
+  double GetAverageWaitTime();
+  std::pair<double,double> GetAverageMessageStatistics();
+  double GetPredictedSweepEfficiency() const {return predicted_efficiency;}
+  double GetMeasuredSweepEfficiency();
 
 private:
+  std::pair<size_t,size_t> CountMessagesSent();
+  void CompleteSweepCommunication();
   void ScheduleAlgoFIFO();
 
   //02
   void InitializeAlgoDOG();
   void ScheduleAlgoDOG();
+
+  //03
+  void InitializeAlgoCriticalPath();
+  void ScheduleAlgoCriticalPath();
 };
 
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h"
 
 #include <chi_log.h>
 
@@ -21,6 +22,15 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
 
   if (scheduler_type == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     InitializeAlgoDOG();
+  else if (scheduler_type == SchedulingAlgorithm::CRITICAL_PATH)
+    InitializeAlgoCriticalPath();
+
+  //=================================== Share the local psi arena. Only one
+  //                                    angleset executes at a time.
+  if (in_angle_agg->local_psi_arena)
+    for (auto& angsetgrp : in_angle_agg->angle_set_groups)
+      for (auto& angset : angsetgrp.angle_sets)
+        angset->local_psi_arena = in_angle_agg->local_psi_arena;
 
   //=================================== Initialize delayed upstream data
   for (auto& angsetgrp : in_angle_agg->angle_set_groups)
@@ -51,4 +61,23 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
   for (auto& angsetgrp : in_angle_agg->angle_set_groups)
     for (auto angset : angsetgrp.angle_sets)
       angset->SetMaxBufferMessages(global_max_num_messages);
+
+  //=================================== Register anglesets with the
+  //                                    message aggregator
+  auto& aggregator = in_angle_agg->message_aggregator;
+  std::vector<AngleSet*> angle_sets_by_number;
+  for (auto& angsetgrp : in_angle_agg->angle_set_groups)
+    for (auto& angset : angsetgrp.angle_sets)
+    {
+      angle_sets_by_number.push_back(angset.get());
+      angset->SetMessageAggregator(aggregator.get());
+    }
+
+  if (aggregator)
+    aggregator->Initialize(angle_sets_by_number, global_max_num_messages);
+
+  //=================================== Communication statistics baseline
+  for (double wait_time : GetAngleSetWaitTimes())
+    initial_wait_time += wait_time;
+  initial_messages_sent = CountMessagesSent();
 }
\ No newline at end of file
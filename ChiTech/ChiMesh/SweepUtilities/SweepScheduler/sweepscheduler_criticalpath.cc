@@ -0,0 +1,354 @@
+#include "sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h"
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+
+extern ChiMPI& chi_mpi;
+extern ChiLog& chi_log;
+
+#include <map>
+#include <queue>
+#include <tuple>
+#include <sstream>
+#include <algorithm>
+
+namespace
+{
+  //###################################################################
+  /**Location task graph of a sweep ordering. The critical path of a
+   * location is the longest path, in cells, from the start of its task to
+   * the end of the sweep (the b-level of the task).*/
+  struct LocationGraph
+  {
+    std::vector<std::vector<int>> successors;
+    std::vector<int>              num_predecessors;
+    std::vector<double>           critical_path;
+  };
+
+  //###################################################################
+  /**Builds the location graph of a sweep ordering from its global
+   * dependencies. Dependencies removed to break cycles do not point to a
+   * later sweep plane and are skipped.*/
+  LocationGraph BuildLocationGraph(
+    const chi_mesh::sweep_management::SPDS& spds,
+    const std::vector<double>& loc_num_cells)
+  {
+    const auto& planes = spds.global_sweep_planes;
+    const int num_locs = static_cast<int>(loc_num_cells.size());
+
+    std::vector<int> plane_of_loc(num_locs,-1);
+    for (size_t level=0; level<planes.size(); level++)
+      for (int loc : planes[level].item_id)
+        plane_of_loc[loc] = static_cast<int>(level);
+
+    LocationGraph graph;
+    graph.successors.resize(num_locs);
+    graph.num_predecessors.assign(num_locs,0);
+    graph.critical_path.assign(num_locs,0.0);
+
+    for (int loc=0; loc<num_locs; loc++)
+      for (int dep : spds.global_dependencies[loc])
+      {
+        if (dep < 0 or dep >= num_locs) continue;
+        if (plane_of_loc[dep] < 0 or
+            plane_of_loc[dep] >= plane_of_loc[loc]) continue;
+
+        graph.successors[dep].push_back(loc);
+        ++graph.num_predecessors[loc];
+      }
+
+    //================================= Accumulate from the last plane up
+    for (auto plane = planes.rbegin(); plane != planes.rend(); ++plane)
+      for (int loc : plane->item_id)
+      {
+        double max_successor_path = 0.0;
+        for (int successor : graph.successors[loc])
+          max_successor_path = std::max(max_successor_path,
+                                        graph.critical_path[successor]);
+
+        graph.critical_path[loc] = loc_num_cells[loc] + max_successor_path;
+      }
+
+    return graph;
+  }
+
+  //###################################################################
+  /**Simulates the sweep on all locations and returns the predicted
+   * parallel efficiency, i.e. the total work divided by the number of
+   * locations times the makespan. Each location executes one angleset at
+   * a time, always picking the ready angleset of highest priority, and
+   * communication is assumed free.*/
+  double SimulateSweepEfficiency(
+    const std::vector<const LocationGraph*>& angleset_graphs,
+    const std::vector<double>& angleset_work,
+    const std::vector<double>& loc_num_cells)
+  {
+    const size_t num_anglesets = angleset_graphs.size();
+    const size_t num_locs      = loc_num_cells.size();
+
+    //Priority, downstream locations, negated angleset number
+    typedef std::tuple<double,size_t,long> ReadyTask;
+    typedef std::pair<double,size_t>       Completion; //Time, task
+
+    std::vector<std::priority_queue<ReadyTask>> ready(num_locs);
+    std::priority_queue<Completion,
+                        std::vector<Completion>,
+                        std::greater<Completion>> completions;
+    std::vector<bool> busy(num_locs,false);
+    std::vector<int>  num_remaining_deps(num_anglesets*num_locs,0);
+
+    auto MakeReady = [&](size_t as, size_t loc)
+    {
+      const auto& graph = *angleset_graphs[as];
+      ready[loc].emplace(angleset_work[as]*graph.critical_path[loc],
+                         graph.successors[loc].size(),
+                         -static_cast<long>(as));
+    };
+
+    auto StartNext = [&](size_t loc, double time)
+    {
+      if (busy[loc] or ready[loc].empty()) return;
+      size_t as = -std::get<2>(ready[loc].top());
+      ready[loc].pop();
+      busy[loc] = true;
+      completions.emplace(time + angleset_work[as]*loc_num_cells[loc],
+                          as*num_locs + loc);
+    };
+
+    double total_work = 0.0;
+    for (size_t as=0; as<num_anglesets; as++)
+      for (size_t loc=0; loc<num_locs; loc++)
+      {
+        total_work += angleset_work[as]*loc_num_cells[loc];
+        num_remaining_deps[as*num_locs + loc] =
+          angleset_graphs[as]->num_predecessors[loc];
+        if (num_remaining_deps[as*num_locs + loc] == 0)
+          MakeReady(as,loc);
+      }
+
+    for (size_t loc=0; loc<num_locs; loc++)
+      StartNext(loc,0.0);
+
+    double makespan = 0.0;
+    while (not completions.empty())
+    {
+      auto completion = completions.top();
+      completions.pop();
+
+      makespan = completion.first;
+      size_t as  = completion.second / num_locs;
+      size_t loc = completion.second % num_locs;
+      busy[loc] = false;
+
+      for (int successor : angleset_graphs[as]->successors[loc])
+        if (--num_remaining_deps[as*num_locs + successor] == 0)
+        {
+          MakeReady(as,successor);
+          StartNext(successor,makespan);
+        }
+
+      StartNext(loc,makespan);
+    }
+
+    if (makespan <= 0.0) return 1.0;
+
+    return total_work/(static_cast<double>(num_locs)*makespan);
+  }
+}
+
+//###################################################################
+/**Initializes the Critical-Path algorithm. The priority of an angleset
+ * is the work remaining on the longest path from this location to the
+ * end of its sweep, estimated from the number of cells on each location
+ * and the number of angles and groups in the angleset. Ties are broken by
+ * the number of downstream locations unblocked and then by the
+ * depth-of-graph.
+ *
+ * Since the estimates are global, every location also simulates the
+ * complete sweep to predict its parallel efficiency.*/
+void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoCriticalPath()
+{
+  //================================================== Gather location work
+  int local_num_cells = 0;
+  if (not angle_agg->angle_set_groups.empty() and
+      not angle_agg->angle_set_groups.front().angle_sets.empty())
+    local_num_cells = static_cast<int>(angle_agg->angle_set_groups.front().
+      angle_sets.front()->GetSPDS()->spls.item_id.size());
+
+  std::vector<int> loc_num_cells_int(chi_mpi.process_count,0);
+  MPI_Allgather(&local_num_cells, 1, MPI_INT,
+                loc_num_cells_int.data(), 1, MPI_INT,
+                MPI_COMM_WORLD);
+
+  std::vector<double> loc_num_cells(loc_num_cells_int.begin(),
+                                    loc_num_cells_int.end());
+
+  //================================================== Build rule values
+  std::map<SPDS*,LocationGraph> spds_graphs;
+  std::vector<const LocationGraph*> angleset_graphs;
+  std::vector<double>               angleset_work;
+
+  for (size_t q=0; q<angle_agg->angle_set_groups.size(); q++)
+  {
+    TAngleSetGroup& angleset_group = angle_agg->angle_set_groups[q];
+
+    size_t num_anglesets = angleset_group.angle_sets.size();
+    for (size_t as=0; as<num_anglesets; as++)
+    {
+      auto angleset = angleset_group.angle_sets[as];
+      auto spds     = angleset->GetSPDS();
+
+      auto graph_it = spds_graphs.find(spds.get());
+      if (graph_it == spds_graphs.end())
+        graph_it = spds_graphs.emplace(
+          spds.get(), BuildLocationGraph(*spds,loc_num_cells)).first;
+      const LocationGraph& graph = graph_it->second;
+
+      double work_per_cell = static_cast<double>(angleset->angles.size())*
+                             angleset->GetNumGrps();
+
+      //========================== Location depth
+      const auto& leveled_graph = spds->global_sweep_planes;
+      int loc_depth = -1;
+      for (size_t level=0; level<leveled_graph.size(); level++)
+        for (int loc : leveled_graph[level].item_id)
+          if (loc == chi_mpi.location_id)
+            loc_depth = static_cast<int>(leveled_graph.size()-level);
+
+      if (loc_depth < 0)
+      {
+        chi_log.Log(LOG_ALLERROR)
+          << "Location depth not found in Critical-Path algorithm.";
+        exit(EXIT_FAILURE);
+      }
+
+      RULE_VALUES new_rule_vals(angleset);
+      new_rule_vals.depth_of_graph = loc_depth;
+      new_rule_vals.set_index      = as + q * num_anglesets;
+      new_rule_vals.critical_path  =
+        work_per_cell*graph.critical_path[chi_mpi.location_id];
+      new_rule_vals.num_successors =
+        static_cast<int>(spds->location_successors.size());
+
+      rule_values.push_back(new_rule_vals);
+      angleset_graphs.push_back(&graph);
+      angleset_work.push_back(work_per_cell);
+    }//for anglesets
+  }//for angleset groups
+
+  //================================================== Sort by priority
+  std::stable_sort(rule_values.begin(),rule_values.end(),
+                   [](const RULE_VALUES& a, const RULE_VALUES& b)
+                   {
+                     if (a.critical_path != b.critical_path)
+                       return a.critical_path > b.critical_path;
+                     if (a.num_successors != b.num_successors)
+                       return a.num_successors > b.num_successors;
+                     return a.depth_of_graph > b.depth_of_graph;
+                   });
+
+  //================================================== Predict efficiency
+  predicted_efficiency = SimulateSweepEfficiency(angleset_graphs,
+                                                 angleset_work,
+                                                 loc_num_cells);
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "Critical-Path sweep scheduler predicted efficiency: "
+    << predicted_efficiency;
+}
+
+//###################################################################
+/**Executes the Critical-Path algorithm. All anglesets are polled on
+ * every scheduling step but only the ready angleset of highest priority
+ * is executed, after which the anglesets are polled again. Hence an
+ * angleset on the critical path that becomes ready while another
+ * executes overtakes all lower priority anglesets.*/
+void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoCriticalPath()
+{
+  typedef ExecutionPermission ExePerm;
+  typedef AngleSetStatus Status;
+
+  chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_BEGIN);
+
+  auto ev_info =
+    std::make_shared<ChiLog::EventInfo>(std::string("Sweep initiated"));
+
+  chi_log.LogEvent(sweep_event_tag,
+                   ChiLog::EventType::SINGLE_OCCURRENCE,ev_info);
+
+  //==================================================== Loop till done
+  bool finished = false;
+  while (!finished)
+  {
+    finished = true;
+    int next_angleset = -1;
+    for (size_t as=0; as<rule_values.size(); as++)
+    {
+      Status status = rule_values[as].angle_set->
+        AngleSetAdvance(sweep_chunk,
+                        rule_values[as].set_index,
+                        sweep_timing_events_tag,
+                        ExePerm::NO_EXEC_IF_READY);
+
+      if (status == Status::READY_TO_EXECUTE and next_angleset < 0)
+        next_angleset = static_cast<int>(as);
+
+      if (status != Status::FINISHED)
+        finished = false;
+    }
+
+    //=============================== Execute highest priority ready
+    if (next_angleset >= 0)
+    {
+      auto& rule = rule_values[next_angleset];
+
+      std::stringstream message_i;
+      message_i
+        << "Angleset " << rule.set_index
+        << " executed on location " << chi_mpi.location_id;
+
+      auto ev_info_i = std::make_shared<ChiLog::EventInfo>(message_i.str());
+
+      chi_log.LogEvent(sweep_event_tag,
+                       ChiLog::EventType::SINGLE_OCCURRENCE,ev_info_i);
+
+      rule.angle_set->AngleSetAdvance(sweep_chunk,
+                                      rule.set_index,
+                                      sweep_timing_events_tag,
+                                      ExePerm::EXECUTE);
+
+      std::stringstream message_f;
+      message_f
+        << "Angleset " << rule.set_index
+        << " finished on location " << chi_mpi.location_id;
+
+      auto ev_info_f = std::make_shared<ChiLog::EventInfo>(message_f.str());
+
+      chi_log.LogEvent(sweep_event_tag,
+                       ChiLog::EventType::SINGLE_OCCURRENCE,ev_info_f);
+    }
+
+    if (angle_agg->message_aggregator)
+      angle_agg->message_aggregator->Progress();
+  }//while not finished
+
+  //================================================== Receive delayed data
+  CompleteSweepCommunication();
+
+  //================================================== Reset all
+  for (auto& angset_group : angle_agg->angle_set_groups)
+    angset_group.ResetSweep();
+
+  for (auto bndry : angle_agg->sim_boundaries)
+  {
+    if (bndry->Type() == chi_mesh::sweep_management::BoundaryType::REFLECTING)
+    {
+      auto rbndry = std::static_pointer_cast<
+        chi_mesh::sweep_management::BoundaryReflecting>(bndry);
+      rbndry->ResetAnglesReadyStatus();
+    }
+  }
+
+  chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_END);
+}
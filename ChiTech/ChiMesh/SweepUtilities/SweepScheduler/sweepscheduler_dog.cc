@@ -1,4 +1,5 @@
 #include "sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h"
 
 #include <chi_mpi.h>
 #include <chi_log.h>
@@ -190,6 +191,9 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
       if (status != Status::FINISHED)
         finished = false;
     }//for each angleset rule
+
+    if (angle_agg->message_aggregator)
+      angle_agg->message_aggregator->Progress();
   }//while not finished
 
 //  //================================================== Reset all
@@ -206,20 +210,7 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
 //  }
 
   //================================================== Receive delayed data
-  MPI_Barrier(MPI_COMM_WORLD);
-  bool received_delayed_data = false;
-  while (not received_delayed_data)
-  {
-    received_delayed_data = true;
-    for (auto sorted_angleset : rule_values)
-    {
-      auto angleset = sorted_angleset.angle_set;
-
-      if (angleset->FlushSendBuffers() == Status::MESSAGES_PENDING)
-        received_delayed_data = false;
-      angleset->ReceiveDelayedData(sorted_angleset.set_index);
-    }
-  }
+  CompleteSweepCommunication();
 
 //  for (auto sorted_angleset : rule_values)
 //  {
@@ -1,4 +1,5 @@
 #include "sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h"
 
 #include <chi_mpi.h>
 #include <chi_log.h>
@@ -29,11 +30,19 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO()
     completion_status = AngleSetStatus::FINISHED;
     for (int q=0; q<angle_agg->angle_set_groups.size(); q++)
     {
-      completion_status = angle_agg->angle_set_groups[q].
+      auto group_status = angle_agg->angle_set_groups[q].
         AngleSetGroupAdvance(sweep_chunk, q, sweep_timing_events_tag);
+      if (group_status == AngleSetStatus::NOT_FINISHED)
+        completion_status = AngleSetStatus::NOT_FINISHED;
     }
+
+    if (angle_agg->message_aggregator)
+      angle_agg->message_aggregator->Progress();
   }
 
+  //================================================== Receive delayed data
+  CompleteSweepCommunication();
+
   //================================================== Reset all
   for (auto& angsetgroup : angle_agg->angle_set_groups)
     angsetgroup.ResetSweep();
@@ -48,14 +57,6 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO()
     }
   }
 
-  //================================================== Receive delayed data
-  MPI_Barrier(MPI_COMM_WORLD);
-  for (auto& sorted_angleset : rule_values)
-  {
-    auto angleset = sorted_angleset.angle_set;
-    angleset->ReceiveDelayedData(sorted_angleset.set_index);
-  }
-
   chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_END);
 
 }
\ No newline at end of file
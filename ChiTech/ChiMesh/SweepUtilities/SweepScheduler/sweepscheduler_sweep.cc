@@ -1,7 +1,10 @@
 #include "sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/MessageAggregator/message_aggregator.h"
 
 #include <chi_log.h>
+#include <chi_mpi.h>
 extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
 
 //###################################################################
 /**This is the entry point for sweeping.*/
@@ -9,11 +12,14 @@ void chi_mesh::sweep_management::SweepScheduler::
      Sweep(SweepChunk* in_sweep_chunk)
 {
   sweep_chunk = in_sweep_chunk;
+  ++num_sweeps;
 
   if (scheduler_type == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO();
   else if (scheduler_type == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     ScheduleAlgoDOG();
+  else if (scheduler_type == SchedulingAlgorithm::CRITICAL_PATH)
+    ScheduleAlgoCriticalPath();
 }
 
 //###################################################################
@@ -51,4 +57,130 @@ std::vector<double>
   info.push_back(ratio_sweep_to_chunk);
 
   return info;
+}
+
+//###################################################################
+/**Get the measured parallel efficiency of all sweeps: the chunk time
+ * summed over all locations divided by the number of locations times the
+ * longest total sweep time. This is a collective operation.*/
+double chi_mesh::sweep_management::SweepScheduler::GetMeasuredSweepEfficiency()
+{
+  auto timings = GetAngleSetTimings();
+
+  double total_chunk_time = 0.0;
+  double max_sweep_time   = 0.0;
+  MPI_Allreduce(&timings[1], &total_chunk_time, 1, MPI_DOUBLE,
+                MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&timings[0], &max_sweep_time, 1, MPI_DOUBLE,
+                MPI_MAX, MPI_COMM_WORLD);
+
+  if (max_sweep_time <= 0.0) return 0.0;
+
+  return total_chunk_time/(chi_mpi.process_count*max_sweep_time);
+}
+
+//###################################################################
+/**Get the accumulated time, in seconds, that each angleset has waited
+ * for its upstream data over all sweeps. The wait of an angleset runs
+ * from its first poll in a sweep until its last upstream message has
+ * arrived, hence communication that overlaps with the execution of
+ * other anglesets is included. Anglesets are ordered by angleset group.*/
+std::vector<double>
+  chi_mesh::sweep_management::SweepScheduler::GetAngleSetWaitTimes()
+{
+  std::vector<double> wait_times;
+  for (auto& angsetgrp : angle_agg->angle_set_groups)
+    for (auto& angset : angsetgrp.angle_sets)
+      wait_times.push_back(angset->GetWaitTime());
+
+  return wait_times;
+}
+
+//###################################################################
+/**Get the average, over sweeps, of the summed upstream wait time of
+ * all anglesets.*/
+double chi_mesh::sweep_management::SweepScheduler::GetAverageWaitTime()
+{
+  if (num_sweeps == 0) return 0.0;
+
+  double total_wait_time = 0.0;
+  for (double wait_time : GetAngleSetWaitTimes())
+    total_wait_time += wait_time;
+
+  return (total_wait_time - initial_wait_time)/num_sweeps;
+}
+
+//###################################################################
+/**Counts the messages, and their total size in bytes, sent by the
+ * anglesets and the message aggregator during their lifetime.*/
+std::pair<size_t,size_t>
+  chi_mesh::sweep_management::SweepScheduler::CountMessagesSent()
+{
+  size_t num_messages = 0;
+  size_t num_bytes    = 0;
+  for (auto& angsetgrp : angle_agg->angle_set_groups)
+    for (auto& angset : angsetgrp.angle_sets)
+    {
+      num_messages += angset->GetNumMessagesSent();
+      num_bytes    += angset->GetNumBytesSent();
+    }
+
+  if (angle_agg->message_aggregator)
+  {
+    num_messages += angle_agg->message_aggregator->GetNumMessagesSent();
+    num_bytes    += angle_agg->message_aggregator->GetNumBytesSent();
+  }
+
+  return {num_messages, num_bytes};
+}
+
+//###################################################################
+/**Get the average number of messages, and their total size in bytes,
+ * sent by this location per sweep. With message aggregation these are
+ * the aggregated packs, headers included.*/
+std::pair<double,double>
+  chi_mesh::sweep_management::SweepScheduler::GetAverageMessageStatistics()
+{
+  if (num_sweeps == 0) return {0.0,0.0};
+
+  auto messages_sent = CountMessagesSent();
+
+  return {double(messages_sent.first  - initial_messages_sent.first)/num_sweeps,
+          double(messages_sent.second - initial_messages_sent.second)/num_sweeps};
+}
+
+//###################################################################
+/**Completes the communication of a sweep. Outstanding sends are
+ * flushed and delayed data is received on all anglesets. Each location
+ * only waits for its own point-to-point messages, which avoids a
+ * global barrier at the end of every sweep.*/
+void chi_mesh::sweep_management::SweepScheduler::CompleteSweepCommunication()
+{
+  typedef AngleSetStatus Status;
+  auto& aggregator = angle_agg->message_aggregator;
+
+  bool completed = false;
+  while (not completed)
+  {
+    completed = true;
+    if (aggregator)
+    {
+      aggregator->Progress();
+      if (not aggregator->SendsComplete()) completed = false;
+    }
+    for (size_t q=0; q<angle_agg->angle_set_groups.size(); q++)
+    {
+      auto& angle_sets = angle_agg->angle_set_groups[q].angle_sets;
+      for (size_t as=0; as<angle_sets.size(); as++)
+      {
+        auto& angleset = angle_sets[as];
+        int angset_number = as + q * angle_sets.size();
+
+        if (angleset->FlushSendBuffers() == Status::MESSAGES_PENDING)
+          completed = false;
+        if (angleset->ReceiveDelayedData(angset_number) == Status::RECEIVING)
+          completed = false;
+      }
+    }
+  }
 }
\ No newline at end of file
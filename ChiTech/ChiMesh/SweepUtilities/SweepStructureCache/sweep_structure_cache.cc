@@ -0,0 +1,147 @@
+#include "sweep_structure_cache.h"
+
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+#include "ChiConsole/chi_console.h"
+
+extern ChiLog&     chi_log;
+extern ChiMPI&     chi_mpi;
+extern ChiConsole& chi_console;
+
+#include <iomanip>
+#include <sstream>
+
+//###################################################################
+/**Returns the sweep ordering for the given direction, building it if
+ * it is not cached. Requesting a different grid clears the cache.*/
+std::shared_ptr<chi_mesh::sweep_management::SPDS>
+chi_mesh::sweep_management::SweepStructureCache::
+GetSPDS(double polar, double azimuthal,
+        chi_mesh::MeshContinuumPtr in_grid,
+        bool allow_cycles, bool reorder_ties)
+{
+  if (in_grid != grid)
+  {
+    Clear();
+    grid = in_grid;
+  }
+
+  if (not plan_file_base.empty() and not plan_read)
+    ReadPlan();
+
+  SPDSKey key(polar, azimuthal, allow_cycles, reorder_ties);
+
+  auto cached = spds_cache.find(key);
+  if (cached != spds_cache.end())
+  {
+    ++num_spds_reused;
+    return cached->second;
+  }
+
+  auto spds = CreateSweepOrder(polar, azimuthal, grid, allow_cycles);
+  if (reorder_ties)
+    spds->ReorderLevelTiesForMemory();
+
+  spds_cache[key] = spds;
+  ++num_spds_built;
+  plan_dirty = true;
+
+  return spds;
+}
+
+//###################################################################
+/**Returns the primary FLUDS of a sweep ordering, building it if it is
+ * not cached. G is only used when the FLUDS is built since anglesets
+ * access it through an AUX_FLUDS.*/
+std::shared_ptr<chi_mesh::sweep_management::PRIMARY_FLUDS>
+chi_mesh::sweep_management::SweepStructureCache::
+GetPrimaryFLUDS(const std::shared_ptr<SPDS>& spds, int G,
+                std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
+                bool concurrent_levels)
+{
+  FLUDSKey key(spds.get(), concurrent_levels);
+
+  auto cached = fluds_cache.find(key);
+  if (cached != fluds_cache.end())
+  {
+    ++num_fluds_reused;
+    return cached->second;
+  }
+
+  auto fluds = std::make_shared<PRIMARY_FLUDS>(G, grid_nodal_mappings);
+
+  //============================================= Load from the plan
+  auto planned = plan_fluds.find(key);
+  if (planned != plan_fluds.end())
+  {
+    std::istringstream blob(planned->second);
+    fluds->Deserialize(blob);
+    plan_fluds.erase(planned);
+
+    fluds_cache[key] = fluds;
+    ++num_fluds_loaded;
+
+    return fluds;
+  }
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << "Initializing FLUDS for omega="
+    << spds->omega.PrintS()
+    << "         Process memory = "
+    << std::setprecision(3) << chi_console.GetMemoryUsageInMB()
+    << " MB.";
+
+  try{fluds->InitializeAlphaElements(spds, concurrent_levels);}
+  catch (const std::exception& exc)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Unknown error in PRIMARY_FLUDS::\n"
+         "InitializeAlphaElements. " << exc.what();
+    exit(EXIT_FAILURE);
+  }
+  try{fluds->InitializeBetaElements(spds);}
+  catch (const std::exception& exc)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Unknown error in PRIMARY_FLUDS::\n"
+         "InitializeBetaElements. " << exc.what();
+    exit(EXIT_FAILURE);
+  }
+
+  fluds_cache[key] = fluds;
+  ++num_fluds_built;
+  plan_dirty = true;
+
+  return fluds;
+}
+
+//###################################################################
+/**Releases all cached structures. Anglesets built on them must have
+ * been destroyed beforehand.*/
+void chi_mesh::sweep_management::SweepStructureCache::Clear()
+{
+  fluds_cache.clear();
+  spds_cache.clear();
+  plan_fluds.clear();
+  grid = nullptr;
+  plan_read  = false;
+  plan_dirty = false;
+}
+
+//###################################################################
+/**Logs the number of structures built and reused so far.*/
+void chi_mesh::sweep_management::SweepStructureCache::LogStatistics()
+{
+  chi_log.Log(LOG_0)
+    << "Sweep structure cache: SPDS built " << num_spds_built
+    << " reused " << num_spds_reused
+    << ", FLUDS built " << num_fluds_built
+    << " reused " << num_fluds_reused;
+
+  if (not plan_file_base.empty())
+    chi_log.Log(LOG_0)
+      << "Sweep plan: SPDS loaded " << num_spds_loaded
+      << ", FLUDS loaded " << num_fluds_loaded;
+}
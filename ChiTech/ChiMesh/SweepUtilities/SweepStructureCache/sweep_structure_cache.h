@@ -0,0 +1,80 @@
+#ifndef CHI_SWEEP_STRUCTURE_CACHE_H
+#define CHI_SWEEP_STRUCTURE_CACHE_H
+
+#include "ChiMesh/SweepUtilities/sweep_namespace.h"
+#include "ChiMesh/SweepUtilities/FLUDS/FLUDS.h"
+
+#include <map>
+#include <tuple>
+#include <string>
+
+//###################################################################
+/**Cache of sweep orderings (SPDS) and primary flux data structures
+ * (FLUDS), shared by all groupsets of a solver and by repeated
+ * executions.
+ *
+ * An SPDS depends only on the grid, the direction, the cycle policy and
+ * whether level ties are reordered. A primary FLUDS depends only on its
+ * SPDS and on whether concurrent levels are required. Anglesets wrap a
+ * cached primary FLUDS in an AUX_FLUDS with their own group count, hence
+ * they never own cached structures.
+ *
+ * The cache is cleared when a different grid is requested or by an
+ * explicit call to Clear(). Building a structure is collective, hence
+ * all locations must request the same structures in the same order.
+ *
+ * When a plan file is set, the cache is seeded from per-location
+ * sweep-plan files on the first request and written back after new
+ * structures were built. A plan is only used when the mesh fingerprint
+ * of every location matches the one stored in its file.*/
+class chi_mesh::sweep_management::SweepStructureCache
+{
+private:
+  typedef std::tuple<double,double,bool,bool> SPDSKey;
+  typedef std::pair<const SPDS*,bool>         FLUDSKey;
+
+  chi_mesh::MeshContinuumPtr                          grid = nullptr;
+  std::map<SPDSKey, std::shared_ptr<SPDS>>            spds_cache;
+  std::map<FLUDSKey, std::shared_ptr<PRIMARY_FLUDS>>  fluds_cache;
+
+  size_t num_spds_built  = 0;
+  size_t num_spds_reused = 0;
+  size_t num_fluds_built  = 0;
+  size_t num_fluds_reused = 0;
+  size_t num_spds_loaded  = 0;
+  size_t num_fluds_loaded = 0;
+
+  //Sweep plan
+  std::string plan_folder_name;
+  std::string plan_file_base;
+  bool        plan_read  = false;
+  bool        plan_dirty = false;
+  std::map<FLUDSKey, std::string> plan_fluds; ///< Serialized FLUDS not yet requested
+
+public:
+  bool enabled = true;
+
+  std::shared_ptr<SPDS>
+  GetSPDS(double polar, double azimuthal,
+          chi_mesh::MeshContinuumPtr in_grid,
+          bool allow_cycles, bool reorder_ties);
+
+  std::shared_ptr<PRIMARY_FLUDS>
+  GetPrimaryFLUDS(const std::shared_ptr<SPDS>& spds, int G,
+                  std::vector<CellFaceNodalMapping>& grid_nodal_mappings,
+                  bool concurrent_levels);
+
+  void Clear();
+  void LogStatistics();
+
+  //sweep_structure_cache_plan.cc
+  void SetPlanFile(const std::string& folder_name,
+                   const std::string& file_base);
+  void WritePlan();
+private:
+  std::string PlanFileName() const;
+  uint64_t    ComputeMeshFingerprint() const;
+  void        ReadPlan();
+};
+
+#endif
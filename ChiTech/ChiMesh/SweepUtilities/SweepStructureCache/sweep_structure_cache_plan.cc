@@ -0,0 +1,315 @@
+#include "sweep_structure_cache.h"
+
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+#include "ChiMesh/SweepUtilities/SweepPlan/sweep_plan_io.h"
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include <chi_log.h>
+#include <chi_mpi.h>
+
+extern ChiLog&     chi_log;
+extern ChiMPI&     chi_mpi;
+
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+namespace
+{
+  const uint64_t SWEEP_PLAN_MAGIC   = 0x4e4c505357494843; //"CHISWPLN"
+  const uint32_t SWEEP_PLAN_VERSION = 1;
+
+  /**FNV-1a hash accumulation of a trivially copyable value.*/
+  template<typename T>
+  void HashValue(uint64_t& hash, const T& value)
+  {
+    auto bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (size_t b=0; b<sizeof(T); ++b)
+    {
+      hash ^= bytes[b];
+      hash *= 0x100000001b3;
+    }
+  }
+}
+
+//###################################################################
+/**Sets the folder and file base of the per-location sweep-plan files.
+ * An empty file base disables sweep plans.*/
+void chi_mesh::sweep_management::SweepStructureCache::
+SetPlanFile(const std::string& folder_name, const std::string& file_base)
+{
+  plan_folder_name = folder_name;
+  plan_file_base   = file_base;
+  plan_read = false;
+}
+
+//###################################################################
+/**Returns the sweep-plan file name of this location.*/
+std::string chi_mesh::sweep_management::SweepStructureCache::
+PlanFileName() const
+{
+  return plan_folder_name + std::string("/") + plan_file_base +
+         std::to_string(chi_mpi.location_id) + std::string(".sp");
+}
+
+//###################################################################
+/**Computes a hash of everything the sweep structures of this location
+ * depend on: the process count, the local cells with their vertices,
+ * faces and neighbor partitions, and the face categorization.*/
+uint64_t chi_mesh::sweep_management::SweepStructureCache::
+ComputeMeshFingerprint() const
+{
+  uint64_t hash = 0xcbf29ce484222325;
+
+  HashValue(hash, SWEEP_PLAN_VERSION);
+  HashValue(hash, chi_mpi.process_count);
+  HashValue(hash, static_cast<uint64_t>(grid->local_cells.size()));
+
+  for (const auto& cell : grid->local_cells)
+  {
+    HashValue(hash, cell.global_id);
+    HashValue(hash, cell.partition_id);
+    for (uint64_t vid : cell.vertex_ids)
+    {
+      HashValue(hash, grid->vertices[vid]->x);
+      HashValue(hash, grid->vertices[vid]->y);
+      HashValue(hash, grid->vertices[vid]->z);
+    }
+    for (const auto& face : cell.faces)
+    {
+      HashValue(hash, face.has_neighbor);
+      HashValue(hash, face.neighbor_id);
+      if (face.has_neighbor)
+        HashValue(hash, face.GetNeighborPartitionID(*grid));
+      for (uint64_t vid : face.vertex_ids)
+        HashValue(hash, vid);
+    }
+  }
+
+  size_t num_face_categories = grid->NumberOfFaceHistogramBins();
+  HashValue(hash, static_cast<uint64_t>(num_face_categories));
+  for (size_t fc=0; fc<num_face_categories; ++fc)
+    HashValue(hash,
+              static_cast<uint64_t>(grid->GetFaceHistogramBinDOFSize(fc)));
+
+  return hash;
+}
+
+//###################################################################
+/**Seeds the cache from the sweep-plan file of this location. The plan
+ * is only used if the files of all locations could be read and match
+ * their mesh fingerprints, hence this call is collective.*/
+void chi_mesh::sweep_management::SweepStructureCache::ReadPlan()
+{
+  using namespace plan_io;
+  plan_read = true;
+
+  typedef std::pair<SPDSKey, std::shared_ptr<SPDS>> PlannedSPDS;
+  typedef std::tuple<uint64_t, bool, std::string>   PlannedFLUDS;
+
+  std::vector<PlannedSPDS>  planned_spds;
+  std::vector<PlannedFLUDS> planned_fluds;
+
+  //============================================= Read this location's plan
+  bool location_valid = false;
+  std::ifstream file(PlanFileName(), std::ios::in | std::ios::binary);
+  if (file.is_open())
+  {
+    uint64_t magic = 0;
+    uint32_t version = 0;
+    uint64_t fingerprint = 0;
+    Read(file, magic);
+    Read(file, version);
+    Read(file, fingerprint);
+
+    location_valid = file.good() and
+                     (magic == SWEEP_PLAN_MAGIC) and
+                     (version == SWEEP_PLAN_VERSION) and
+                     (fingerprint == ComputeMeshFingerprint());
+  }
+
+  if (location_valid)
+  {
+    uint64_t num_spds = 0;
+    Read(file, num_spds);
+    for (uint64_t s=0; s<num_spds and file.good(); ++s)
+    {
+      double polar = 0.0, azimuthal = 0.0;
+      bool allow_cycles = false, reorder_ties = false;
+      Read(file, polar);
+      Read(file, azimuthal);
+      Read(file, allow_cycles);
+      Read(file, reorder_ties);
+
+      auto spds = std::make_shared<SPDS>();
+      spds->Deserialize(file);
+      spds->grid = grid;
+
+      planned_spds.emplace_back(
+        SPDSKey(polar, azimuthal, allow_cycles, reorder_ties), spds);
+    }
+
+    uint64_t num_fluds = 0;
+    Read(file, num_fluds);
+    for (uint64_t f=0; f<num_fluds and file.good(); ++f)
+    {
+      uint64_t spds_index = 0;
+      bool concurrent_levels = false;
+      uint64_t blob_size = 0;
+      Read(file, spds_index);
+      Read(file, concurrent_levels);
+      Read(file, blob_size);
+
+      std::string blob(blob_size, '\0');
+      file.read(&blob[0], static_cast<std::streamsize>(blob_size));
+
+      if (spds_index >= planned_spds.size()) {location_valid = false; break;}
+      planned_fluds.emplace_back(spds_index, concurrent_levels, blob);
+    }
+
+    location_valid = location_valid and file.good();
+  }
+  file.close();
+
+  //============================================= All locations must agree
+  bool global_valid = false;
+  MPI_Allreduce(&location_valid,       //Send buffer
+                &global_valid,         //Recv buffer
+                1,                     //count
+                MPI_CXX_BOOL,          //Data type
+                MPI_LAND,              //Operation - Logical and
+                MPI_COMM_WORLD);       //Communicator
+
+  if (not global_valid)
+  {
+    chi_log.Log(LOG_0)
+      << "No valid sweep plan found at " << plan_folder_name << "/"
+      << plan_file_base << ". Sweep structures will be built.";
+    return;
+  }
+
+  //============================================= Seed the cache
+  for (auto& entry : planned_spds)
+    spds_cache[entry.first] = entry.second;
+
+  for (auto& entry : planned_fluds)
+  {
+    const SPDS* spds = planned_spds[std::get<0>(entry)].second.get();
+    plan_fluds[FLUDSKey(spds, std::get<1>(entry))] =
+      std::move(std::get<2>(entry));
+  }
+
+  num_spds_loaded += planned_spds.size();
+
+  chi_log.Log(LOG_0)
+    << "Loaded sweep plan with " << planned_spds.size() << " SPDS and "
+    << planned_fluds.size() << " FLUDS from "
+    << plan_folder_name << "/" << plan_file_base;
+}
+
+//###################################################################
+/**Writes all cached structures to the sweep-plan files if structures
+ * were built since the plan was last read or written. Collective.*/
+void chi_mesh::sweep_management::SweepStructureCache::WritePlan()
+{
+  using namespace plan_io;
+  if (plan_file_base.empty() or (not plan_dirty) or (grid == nullptr))
+    return;
+
+  typedef struct stat Stat;
+  Stat st;
+
+  //======================================== Make sure folder exists
+  if (chi_mpi.location_id == 0)
+  {
+    if (stat(plan_folder_name.c_str(),&st) != 0) //if not exist, make it
+      if ( (mkdir(plan_folder_name.c_str(),S_IRWXU | S_IRWXG | S_IRWXO) != 0) and
+           (errno != EEXIST) )
+        chi_log.Log(LOG_0WARNING)
+          << "Failed to create sweep plan directory: " << plan_folder_name;
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  //======================================== Write file
+  bool location_succeeded = true;
+  std::string file_name = PlanFileName();
+
+  std::ofstream file;
+  file.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (not file.is_open())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Failed to create sweep plan file: " << file_name;
+    location_succeeded = false;
+  }
+  else
+  {
+    Write(file, SWEEP_PLAN_MAGIC);
+    Write(file, SWEEP_PLAN_VERSION);
+    Write(file, ComputeMeshFingerprint());
+
+    std::map<const SPDS*, uint64_t> spds_index;
+    Write(file, static_cast<uint64_t>(spds_cache.size()));
+    for (const auto& entry : spds_cache)
+    {
+      Write(file, std::get<0>(entry.first));
+      Write(file, std::get<1>(entry.first));
+      Write(file, std::get<2>(entry.first));
+      Write(file, std::get<3>(entry.first));
+      entry.second->Serialize(file);
+
+      const uint64_t index = spds_index.size();
+      spds_index[entry.second.get()] = index;
+    }
+
+    //Planned FLUDS that were never requested are written back as is
+    std::map<FLUDSKey, std::string> blobs = plan_fluds;
+    for (const auto& entry : fluds_cache)
+    {
+      auto spds = std::find_if(spds_cache.begin(), spds_cache.end(),
+        [&entry](const std::pair<const SPDSKey, std::shared_ptr<SPDS>>& s)
+        {return s.second.get() == entry.first.first;});
+
+      std::ostringstream blob;
+      entry.second->Serialize(blob, spds->second);
+      blobs[entry.first] = blob.str();
+    }
+
+    Write(file, static_cast<uint64_t>(blobs.size()));
+    for (const auto& entry : blobs)
+    {
+      Write(file, spds_index.at(entry.first.first));
+      Write(file, entry.first.second);
+      Write(file, static_cast<uint64_t>(entry.second.size()));
+      file.write(entry.second.data(),
+                 static_cast<std::streamsize>(entry.second.size()));
+    }
+
+    location_succeeded = file.good();
+    file.close();
+  }
+
+  //======================================== Check success status
+  bool global_succeeded = false;
+  MPI_Allreduce(&location_succeeded,   //Send buffer
+                &global_succeeded,     //Recv buffer
+                1,                     //count
+                MPI_CXX_BOOL,          //Data type
+                MPI_LAND,              //Operation - Logical and
+                MPI_COMM_WORLD);       //Communicator
+
+  if (global_succeeded)
+  {
+    plan_dirty = false;
+    chi_log.Log(LOG_0)
+      << "Wrote sweep plan with " << spds_cache.size() << " SPDS to "
+      << plan_folder_name << "/" << plan_file_base;
+  }
+  else
+    chi_log.Log(LOG_0WARNING)
+      << "Failed to write sweep plan to "
+      << plan_folder_name << "/" << plan_file_base;
+}
@@ -103,6 +103,40 @@ chi_mesh::sweep_management::
     exit(EXIT_FAILURE);
   }
 
+  //============================================= Levelize the ordering
+  //The topological sort is reordered, stable within each level, such that
+  //cells on the same wavefront are contiguous. This remains a valid sweep
+  //ordering and allows concurrent execution of a level.
+  {
+    auto& item_id = sweep_order->spls.item_id;
+
+    std::vector<int> cell_level(num_loc_cells,0);
+    int num_levels = 0;
+    for (int c : item_id)
+    {
+      for (int s : local_DG.vertices[c].ds_edge)
+        cell_level[s] = std::max(cell_level[s], cell_level[c]+1);
+      num_levels = std::max(num_levels, cell_level[c]+1);
+    }
+
+    std::vector<int> level_end(num_levels,0);
+    for (int c : item_id)
+      ++level_end[cell_level[c]];
+    for (int k=1; k<num_levels; ++k)
+      level_end[k] += level_end[k-1];
+
+    std::vector<int> level_pos(num_levels,0);
+    for (int k=1; k<num_levels; ++k)
+      level_pos[k] = level_end[k-1];
+
+    std::vector<int> levelized(item_id.size());
+    for (int c : item_id)
+      levelized[level_pos[cell_level[c]]++] = c;
+
+    item_id = std::move(levelized);
+    sweep_order->spls.levels = std::move(level_end);
+  }
+
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Create Task
   //                                                        Dependency Graphs
   //All locations will gather other locations' dependencies
@@ -20,12 +20,15 @@ namespace sweep_management
   struct SPLS;           ///< Sweep Plane Local Subgrid
   class  PRIMARY_FLUDS;  ///< Primary Flux Data Structure
   class  AUX_FLUDS;      ///< Auxiliary Flux Data Structure
+  class  FLUDSArena;     ///< Aligned storage of FLUDS psi buffers
   struct SPDS;           ///< Sweep Plane Data Structure
 
   class  SweepBuffer;
   class AngleSet;
   class AngleSetGroup;
   class  AngleAggregation;
+  class  SweepMessageAggregator;
+  class  SweepStructureCache;
 
   class SweepChunk;
 
@@ -68,6 +71,12 @@ namespace sweep_management
     MESSAGES_PENDING = 7
   };
   typedef AngleSetStatus ExecutionPermission;
+
+  enum class SchedulingAlgorithm {
+    FIRST_IN_FIRST_OUT = 1,
+    DEPTH_OF_GRAPH = 2,
+    CRITICAL_PATH = 3
+  };
 }
 }
 
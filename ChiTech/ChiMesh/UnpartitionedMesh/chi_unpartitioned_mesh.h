@@ -23,6 +23,7 @@ private:
   struct LightWeightFace
   {
     int neighbor=-1;
+    uint64_t bndry_id=0; ///< Boundary id used when there is no neighbor
     std::vector<uint64_t> vertex_ids;
   };
   struct LightWeightCell
@@ -39,6 +40,10 @@ private:
   std::vector<chi_mesh::Vertex*>  vertices;
   std::vector<LightWeightCell*>    raw_cells;
 
+  /**With DIVIDE_WORK, raw_cells only holds the global cells
+   * [cell_block_starts[loc], cell_block_starts[loc+1]) of each location.*/
+  std::vector<uint64_t>           cell_block_starts;
+
 public:
   enum class ParallelMethod
   {
@@ -67,8 +72,15 @@ public:
   LightWeightCell* CreateCellFromVTKQuad(vtkCell* vtk_cell);
   LightWeightCell* CreateCellFromVTKTriangle(vtkCell* vtk_cell);
 
+  void EstablishCellBlocks();
+  bool IsDivided() const;
+  uint64_t GlobalCellOffset() const;
+  int CellBlockOwner(uint64_t global_id) const;
+
   void ReadFromVTU(const Options& options);
   void ReadFromEnsightGold(const Options& options);
+  void ReadFromCheckpoint(const std::string& folder_name,
+                          const std::string& file_base);
 };
 
 
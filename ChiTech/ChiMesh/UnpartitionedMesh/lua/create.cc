@@ -13,6 +13,11 @@
  * \image html "InProgressImage.png" width=200px
  *
  * \param file_name char Filename of the .vtu file.
+ * \param parallel_method int Optional. ALL_FROM_HOME (default) creates
+ *        all cells on every location, DIVIDE_WORK only creates a block
+ *        of the cells on each location and requires
+ *        VOLUMEMESHER_UNPARTITIONED. In both cases every location still
+ *        parses the whole file and holds all the vertices.
  *
  * \ingroup LuaUnpartitionedMesh
  *
@@ -21,7 +26,7 @@ int chiUnpartitionedMeshFromVTU(lua_State* L)
 {
   const char func_name[] = "chiUnpartitionedMeshFromVTU";
   int num_args = lua_gettop(L);
-  if (num_args != 1)
+  if (num_args < 1)
     LuaPostArgAmountError(func_name,1,num_args);
 
   const char* temp = lua_tostring(L,1);
@@ -29,6 +34,9 @@ int chiUnpartitionedMeshFromVTU(lua_State* L)
 
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
+  if (num_args >= 2)
+    options.parallel_method = static_cast<
+      chi_mesh::UnpartitionedMesh::ParallelMethod>(lua_tonumber(L,2));
 
   new_object->ReadFromVTU(options);
 
@@ -46,6 +54,7 @@ int chiUnpartitionedMeshFromVTU(lua_State* L)
  *
  * \param file_name char Filename of the .case file.
  * \param scale float Scale to apply to the mesh
+ * \param parallel_method int Optional. See chiUnpartitionedMeshFromVTU.
  *
  * \ingroup LuaUnpartitionedMesh
  *
@@ -65,6 +74,9 @@ int chiUnpartitionedMeshFromEnsightGold(lua_State* L)
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
   options.scale = scale;
+  if (num_args >= 3)
+    options.parallel_method = static_cast<
+      chi_mesh::UnpartitionedMesh::ParallelMethod>(lua_tonumber(L,3));
 
   new_object->ReadFromEnsightGold(options);
 
@@ -10,6 +10,12 @@
 #include <vtkQuad.h>
 #include <vtkTriangle.h>
 
+#include "chi_mpi.h"
+
+extern ChiMPI& chi_mpi;
+
+#include <algorithm>
+
 //###################################################################
 /**Creates a raw polyhedron cell from a vtk-polyhedron.*/
 chi_mesh::UnpartitionedMesh::LightWeightCell* chi_mesh::UnpartitionedMesh::
@@ -242,4 +248,52 @@ chi_mesh::UnpartitionedMesh::LightWeightCell* chi_mesh::UnpartitionedMesh::
   }
 
   return polyh_cell;
-}
\ No newline at end of file
+}
+//###################################################################
+/**Establishes the global cell blocks after every location has created
+ * its share of the cells, i.e. for ParallelMethod::DIVIDE_WORK. The
+ * block of a location starts at the sum of the cell counts of all
+ * lower locations.*/
+void chi_mesh::UnpartitionedMesh::EstablishCellBlocks()
+{
+  uint64_t num_local_cells = raw_cells.size();
+  std::vector<uint64_t> num_cells_per_location(chi_mpi.process_count,0);
+  MPI_Allgather(&num_local_cells,             //sendbuf
+                1, MPI_UNSIGNED_LONG_LONG,    //sendcount, sendtype
+                num_cells_per_location.data(),//recvbuf
+                1, MPI_UNSIGNED_LONG_LONG,    //recvcount, recvtype
+                MPI_COMM_WORLD);              //communicator
+
+  cell_block_starts.assign(chi_mpi.process_count+1,0);
+  for (int loc=0; loc<chi_mpi.process_count; ++loc)
+    cell_block_starts[loc+1] = cell_block_starts[loc] +
+                               num_cells_per_location[loc];
+}
+
+//###################################################################
+/**Returns true if the cells of the mesh are divided amongst the
+ * locations.*/
+bool chi_mesh::UnpartitionedMesh::IsDivided() const
+{
+  return not cell_block_starts.empty();
+}
+
+//###################################################################
+/**Returns the global id of the first cell in raw_cells.*/
+uint64_t chi_mesh::UnpartitionedMesh::GlobalCellOffset() const
+{
+  if (cell_block_starts.empty()) return 0;
+  return cell_block_starts[chi_mpi.location_id];
+}
+
+//###################################################################
+/**Returns the location holding the raw cell with the given global id.*/
+int chi_mesh::UnpartitionedMesh::CellBlockOwner(uint64_t global_id) const
+{
+  if (cell_block_starts.empty()) return chi_mpi.location_id;
+
+  auto it = std::upper_bound(cell_block_starts.begin(),
+                             cell_block_starts.end(),
+                             global_id);
+  return static_cast<int>(std::distance(cell_block_starts.begin(), it) - 1);
+}
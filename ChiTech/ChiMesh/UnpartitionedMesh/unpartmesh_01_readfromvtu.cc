@@ -34,6 +34,7 @@ void chi_mesh::UnpartitionedMesh::
   file.close();
 
   //======================================== Read the file
+  mesh_options = options;
   vtkSmartPointer<vtkXMLUnstructuredGridReader> reader =
     vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
   reader->SetFileName(options.file_name.c_str());
@@ -61,8 +62,29 @@ void chi_mesh::UnpartitionedMesh::
     << total_cell_count << " "
     << total_point_count;
 
+  //======================================== Divide cells
+  //With DIVIDE_WORK every location only
+  //creates a contiguous block of the cells.
+  //The file is nonetheless parsed in full on
+  //every location, since the duplicate vertex
+  //removal needs the complete point set.
+  //Reading only a per-location piece needs
+  //the grid to hold local vertices and is
+  //not done yet.
+  int c_begin = 0;
+  int c_end   = total_cell_count;
+  if (options.parallel_method == ParallelMethod::DIVIDE_WORK)
+  {
+    int64_t num_cells = total_cell_count;
+    c_begin = static_cast<int>(num_cells*chi_mpi.location_id/
+                               chi_mpi.process_count);
+    c_end   = static_cast<int>(num_cells*(chi_mpi.location_id+1)/
+                               chi_mpi.process_count);
+  }
+
   //======================================== Push cells
-  for (int c=0; c<total_cell_count; ++c)
+  raw_cells.reserve(c_end - c_begin);
+  for (int c=c_begin; c<c_end; ++c)
   {
     auto vtk_cell = ugrid->GetCell(c);
     auto vtk_celltype = vtk_cell->GetCellType();
@@ -74,7 +96,17 @@ void chi_mesh::UnpartitionedMesh::
       raw_cells.push_back(CreateCellFromVTKTetrahedron(vtk_cell));
   }//for c
 
+  if (options.parallel_method == ParallelMethod::DIVIDE_WORK)
+  {
+    EstablishCellBlocks();
+    chi_log.Log(LOG_0)
+      << "Cells divided amongst " << chi_mpi.process_count
+      << " locations.";
+  }
+
   //======================================== Push points
+  //All points are kept, cells refer to them
+  //by their global index.
   for (int p=0; p<total_point_count; ++p)
   {
     auto point = ugrid->GetPoint(p);
@@ -0,0 +1,196 @@
+#include "chi_unpartitioned_mesh.h"
+
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+#include <algorithm>
+#include <cstring>
+
+//###################################################################
+/**Reads a mesh checkpoint written by chi_mesh::MeshContinuum with a
+ * different process count, for repartitioning.
+ *
+ * The checkpoint files are divided amongst the locations. Every
+ * location reads the local cells of its files and sends each cell to the
+ * location holding the block of global ids the cell belongs to. The mesh
+ * is therefore read with ParallelMethod::DIVIDE_WORK and can be
+ * partitioned with VOLUMEMESHER_UNPARTITIONED.*/
+void chi_mesh::UnpartitionedMesh::
+  ReadFromCheckpoint(const std::string& folder_name,
+                     const std::string& file_base)
+{
+  mesh_options.parallel_method = ParallelMethod::DIVIDE_WORK;
+
+  auto info = chi_mesh::MeshContinuum::ReadCheckpointInfo(folder_name,
+                                                          file_base);
+  chi_log.Log(LOG_0)
+    << "Redistributing mesh checkpoint " << folder_name << "/" << file_base
+    << " written by " << info.process_count << " processes with "
+    << info.num_global_cells << " cells.";
+
+  //======================================== Global cell blocks
+  const int num_locations = chi_mpi.process_count;
+  cell_block_starts.assign(num_locations+1,0);
+  for (int loc=0; loc<=num_locations; ++loc)
+    cell_block_starts[loc] = info.num_global_cells*loc/num_locations;
+
+  //======================================== Read local cells of the
+  //                                         files of this location
+  //Record: global id, cell type, material id, centroid x, y, z,
+  //        num vertices, vertex ids, num faces,
+  //        per face: neighbor, boundary id, num vertices, vertex ids
+  std::vector<std::vector<uint64_t>> cell_data(num_locations);
+  for (int file_loc=chi_mpi.location_id; file_loc<info.process_count;
+       file_loc += num_locations)
+  {
+    auto cells_read = chi_mesh::MeshContinuum::
+      ReadCheckpointCells(folder_name, file_base, file_loc);
+
+    for (auto cell : cells_read)
+    {
+      if (cell->partition_id == file_loc)
+      {
+        auto& data = cell_data[CellBlockOwner(cell->global_id)];
+        data.push_back(cell->global_id);
+        data.push_back(static_cast<uint64_t>(cell->Type()));
+        data.push_back(static_cast<uint64_t>(
+                         static_cast<int64_t>(cell->material_id)));
+        for (double value : {cell->centroid.x, cell->centroid.y,
+                             cell->centroid.z})
+        {
+          uint64_t bits;
+          std::memcpy(&bits, &value, sizeof(double));
+          data.push_back(bits);
+        }
+        data.push_back(cell->vertex_ids.size());
+        data.insert(data.end(), cell->vertex_ids.begin(),
+                                cell->vertex_ids.end());
+        data.push_back(cell->faces.size());
+        for (const auto& face : cell->faces)
+        {
+          int64_t neighbor = face.has_neighbor?
+                             static_cast<int64_t>(face.neighbor_id) : -1;
+          data.push_back(static_cast<uint64_t>(neighbor));
+          data.push_back(face.has_neighbor? 0 : face.neighbor_id);
+          data.push_back(face.vertex_ids.size());
+          data.insert(data.end(), face.vertex_ids.begin(),
+                                  face.vertex_ids.end());
+        }
+      }
+      delete cell;
+    }
+  }
+
+  //============================================= Build send-counts and
+  //                                              send-displacements arrays,
+  //                                              and serialized vector
+  std::vector<int> send_counts(num_locations,0);
+  std::vector<int> send_displs(num_locations,0);
+  std::vector<uint64_t> send_buffer;
+
+  int displacement = 0;
+  for (int loc=0; loc<num_locations; ++loc)
+  {
+    send_counts[loc] = static_cast<int>(cell_data[loc].size());
+    send_displs[loc] = displacement;
+    displacement += send_counts[loc];
+
+    send_buffer.insert(send_buffer.end(),
+                       cell_data[loc].begin(), cell_data[loc].end());
+    cell_data[loc] = std::vector<uint64_t>();
+  }
+
+  //============================================= Communicate counts
+  std::vector<int> recv_counts(num_locations,0);
+
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT,
+               recv_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  std::vector<int> recv_displs(num_locations,0);
+  int total_receive_size = 0;
+  for (int loc=0; loc<num_locations; ++loc)
+  {
+    recv_displs[loc] = total_receive_size;
+    total_receive_size += recv_counts[loc];
+  }
+
+  //============================================= Receive serialized data
+  std::vector<uint64_t> recv_buffer(total_receive_size,0);
+  MPI_Alltoallv(send_buffer.data(),
+                send_counts.data(),
+                send_displs.data(),
+                MPI_UNSIGNED_LONG_LONG,
+                recv_buffer.data(),
+                recv_counts.data(),
+                recv_displs.data(),
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_COMM_WORLD);
+  send_buffer = std::vector<uint64_t>();
+
+  //============================================= Deserialize in global
+  //                                              id order
+  const uint64_t cell_offset = GlobalCellOffset();
+  const uint64_t num_local_cells =
+    cell_block_starts[chi_mpi.location_id+1] - cell_offset;
+  raw_cells.assign(num_local_cells, nullptr);
+
+  size_t k=0;
+  while (k<recv_buffer.size())
+  {
+    const uint64_t global_id = recv_buffer[k++];
+    auto cell_type = static_cast<chi_mesh::CellType>(recv_buffer[k++]);
+    auto cell = new LightWeightCell(cell_type);
+    cell->material_id =
+      static_cast<int>(static_cast<int64_t>(recv_buffer[k++]));
+    double xyz[3];
+    std::memcpy(xyz, &recv_buffer[k], 3*sizeof(double)); k += 3;
+    cell->centroid = chi_mesh::Vertex(xyz[0],xyz[1],xyz[2]);
+
+    const uint64_t num_verts = recv_buffer[k++];
+    cell->vertex_ids.assign(recv_buffer.begin() + k,
+                            recv_buffer.begin() + k + num_verts);
+    k += num_verts;
+
+    cell->faces.resize(recv_buffer[k++]);
+    for (auto& face : cell->faces)
+    {
+      face.neighbor = static_cast<int>(static_cast<int64_t>(recv_buffer[k++]));
+      face.bndry_id = recv_buffer[k++];
+      const uint64_t num_face_verts = recv_buffer[k++];
+      face.vertex_ids.assign(recv_buffer.begin() + k,
+                             recv_buffer.begin() + k + num_face_verts);
+      k += num_face_verts;
+    }
+
+    raw_cells[global_id - cell_offset] = cell;
+  }
+
+  if (std::find(raw_cells.begin(), raw_cells.end(), nullptr) !=
+      raw_cells.end())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Mesh checkpoint " << folder_name << "/" << file_base
+      << " is missing cells.";
+    exit(EXIT_FAILURE);
+  }
+
+  //======================================== Vertices
+  chi_mesh::MeshContinuum::ReadCheckpointVertices(folder_name, file_base,
+                                                  vertices);
+  for (auto vertex : vertices)
+  {
+    if (vertex->x < bound_box.xmin) bound_box.xmin = vertex->x;
+    if (vertex->x > bound_box.xmax) bound_box.xmax = vertex->x;
+    if (vertex->y < bound_box.ymin) bound_box.ymin = vertex->y;
+    if (vertex->y > bound_box.ymax) bound_box.ymax = vertex->y;
+    if (vertex->z < bound_box.zmin) bound_box.zmin = vertex->z;
+    if (vertex->z > bound_box.zmax) bound_box.zmax = vertex->z;
+  }
+
+  chi_log.Log(LOG_0) << "Done redistributing mesh checkpoint.";
+}
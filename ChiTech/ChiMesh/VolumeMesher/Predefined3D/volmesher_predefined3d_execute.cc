@@ -49,6 +49,14 @@ void chi_mesh::VolumeMesherPredefined3D::Execute()
     exit(EXIT_FAILURE);
   }
 
+  if (mesh_handler->unpartitionedmesh_stack.back()->IsDivided())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "VolumeMesherPredefined3D: Unpartitioned meshes read with "
+         "DIVIDE_WORK require VOLUMEMESHER_UNPARTITIONED.";
+    exit(EXIT_FAILURE);
+  }
+
   //======================================== Check paritioning params
   int Px = 1;
   int Py = 1;
@@ -14,6 +14,11 @@ public:
   void Execute();
 
   void BuildMeshConnectivity(chi_mesh::UnpartitionedMesh* umesh);
+  void BuildDistributedMeshConnectivity(chi_mesh::UnpartitionedMesh* umesh);
+
+  static uint64_t HashSortedVertexIds(const std::vector<uint64_t>& sorted_vids);
+  static std::vector<uint64_t>
+    ExchangeSerialData(const std::vector<std::vector<uint64_t>>& send_data);
 
   int GetPartitionIDFromCentroid(const chi_mesh::Vertex& centroid);
 
@@ -30,6 +35,10 @@ public:
   void PARMETIS(chi_mesh::UnpartitionedMesh* umesh,
                 chi_mesh::MeshContinuumPtr grid);
 
+  std::vector<int> DistributedPARMETIS(chi_mesh::UnpartitionedMesh* umesh);
+  void DistributedPartition(chi_mesh::UnpartitionedMesh* umesh,
+                            chi_mesh::MeshContinuumPtr grid);
+
   void AddSlabToGrid(
     const chi_mesh::UnpartitionedMesh::LightWeightCell& raw_cell,
     const chi_mesh::Cell& temp_cell,
@@ -30,6 +30,8 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::
       newFace.neighbor_id = raw_face.neighbor;
       newFace.has_neighbor = true;
     }
+    else
+      newFace.neighbor_id = raw_face.bndry_id;
 
     newFace.vertex_ids = raw_face.vertex_ids;
     auto vfc = chi_mesh::Vertex(0.0, 0.0, 0.0);
@@ -76,6 +78,8 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::
       newFace.neighbor_id = raw_face.neighbor;
       newFace.has_neighbor = true;
     }
+    else
+      newFace.neighbor_id = raw_face.bndry_id;
 
     newFace.vertex_ids = raw_face.vertex_ids;
     auto vfc = chi_mesh::Vertex(0.0, 0.0, 0.0);
@@ -124,6 +128,8 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::
       newFace.neighbor_id = raw_face.neighbor;
       newFace.has_neighbor = true;
     }
+    else
+      newFace.neighbor_id = raw_face.bndry_id;
 
     newFace.vertex_ids = raw_face.vertex_ids;
     auto vfc = chi_mesh::Vertex(0.0, 0.0, 0.0);
@@ -7,24 +7,51 @@ extern ChiLog& chi_log;
 #include "ChiTimer/chi_timer.h"
 extern ChiTimer chi_program_timer;
 
+#include <algorithm>
+#include <functional>
+#include <thread>
+
 //###################################################################
-/**Establishes neighbor connectivity for the light-weight mesh.*/
-void chi_mesh::VolumeMesherPredefinedUnpartitioned::
-  BuildMeshConnectivity(chi_mesh::UnpartitionedMesh* umesh)
+/**Returns a 64-bit hash of a sorted list of vertex ids. Faces with the
+ * same vertices have the same hash regardless of their orientation.*/
+uint64_t chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  HashSortedVertexIds(const std::vector<uint64_t>& sorted_vids)
 {
-  //======================================== Populate vertex
-  //                                                   subscriptionns
-  std::vector<std::set<size_t>> vertex_subs(umesh->vertices.size());
-  uint64_t cur_cell_id=0;
-  for (auto& cell : umesh->raw_cells)
+  uint64_t hash = sorted_vids.size();
+  for (uint64_t vid : sorted_vids)
   {
-    for (auto vid : cell->vertex_ids)
-      vertex_subs[vid].insert(cur_cell_id);
-    ++cur_cell_id;
+    //splitmix64 finalizer on each id
+    uint64_t z = vid + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z =  z ^ (z >> 31);
+    hash ^= z + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
   }
+  return hash;
+}
+
+//###################################################################
+/**Establishes neighbor connectivity for the light-weight mesh.
+ *
+ * Every face is given a global index, face_offsets[cell]+f, and a 64-bit
+ * hash of its sorted vertex ids. Faces are then inserted into a flat
+ * open-addressing table (linear probing) keyed on the hash. A face whose
+ * hash matches an unmatched face in the table, with the same vertex ids,
+ * becomes its neighbor. This replaces the vertex-subscription search and
+ * runs in near-linear time.
+ *
+ * With options.connectivity_num_threads > 1 the hashes are computed
+ * over blocks of cells and the faces are divided amongst the threads by
+ * hash. Both faces of a pair have the same hash, so every thread owns a
+ * private table and only modifies its own faces.*/
+void chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  BuildMeshConnectivity(chi_mesh::UnpartitionedMesh* umesh)
+{
+  auto& raw_cells = umesh->raw_cells;
+  const size_t num_cells = raw_cells.size();
 
   int num_bndry_faces = 0;
-  for (auto cell : umesh->raw_cells)
+  for (auto cell : raw_cells)
     for (auto& face : cell->faces)
     {
       if (face.neighbor < 0) ++num_bndry_faces;
@@ -37,55 +64,130 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::
 
   //======================================== Establish connectivity
   chi_log.Log() << "Establishing cell connectivity.";
-  std::set<size_t> cells_to_search;
-  cur_cell_id=0;
-  for (auto& cell : umesh->raw_cells)
+
+  size_t num_threads = 1;
+  if (options.connectivity_num_threads > 1)
+    num_threads = options.connectivity_num_threads;
+  num_threads = std::max<size_t>(1, std::min(num_threads, num_cells));
+
+  auto RunThreaded = [num_threads](const std::function<void(size_t)>& work)
+  {
+    if (num_threads == 1) { work(0); return; }
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (size_t t=0; t<num_threads; ++t)
+      threads.emplace_back(work, t);
+    for (auto& thread : threads)
+      thread.join();
+  };
+
+  //======================================== Global face indices
+  std::vector<uint64_t> face_offsets(num_cells+1, 0);
+  for (size_t c=0; c<num_cells; ++c)
+    face_offsets[c+1] = face_offsets[c] + raw_cells[c]->faces.size();
+  const uint64_t num_faces = face_offsets.back();
+
+  //======================================== Hash face vertex tuples
+  std::vector<uint64_t> face_hash(num_faces, 0);
+  RunThreaded([&](size_t t)
+  {
+    std::vector<uint64_t> sorted_vids;
+    const size_t c_begin = num_cells*t/num_threads;
+    const size_t c_end   = num_cells*(t+1)/num_threads;
+    for (size_t c=c_begin; c<c_end; ++c)
+    {
+      uint64_t f_gid = face_offsets[c];
+      for (const auto& face : raw_cells[c]->faces)
+      {
+        sorted_vids = face.vertex_ids;
+        std::sort(sorted_vids.begin(), sorted_vids.end());
+
+        face_hash[f_gid++] = HashSortedVertexIds(sorted_vids);
+      }
+    }
+  });
+
+  //======================================== Face lookup
+  auto CellOfFace = [&face_offsets](uint64_t f_gid)
+  {
+    auto it = std::upper_bound(face_offsets.begin(), face_offsets.end(),
+                               f_gid);
+    return static_cast<uint64_t>(std::distance(face_offsets.begin(), it) - 1);
+  };
+
+  auto SameVertices = [](const std::vector<uint64_t>& a,
+                         const std::vector<uint64_t>& b)
+  {
+    if (a.size() != b.size()) return false;
+    for (uint64_t vid : a)
+      if (std::find(b.begin(), b.end(), vid) == b.end()) return false;
+    return true;
+  };
+
+  //======================================== Match faces
+  //The low bits of the hash address the table,
+  //the high bits select the thread.
+  const uint64_t EMPTY = ~uint64_t(0);
+  auto OwningThread = [num_threads](uint64_t hash)
   {
-    cells_to_search.clear();
-    for (uint64_t vid : cell->vertex_ids)
-      for (uint64_t cell_id : vertex_subs[vid])
-        if (cell_id != cur_cell_id)
-          cells_to_search.insert(cell_id);
+    return (hash >> 40) % num_threads;
+  };
 
-    for (auto& cur_cell_face : cell->faces)
+  RunThreaded([&](size_t t)
+  {
+    uint64_t num_owned = 0;
+    for (uint64_t f_gid=0; f_gid<num_faces; ++f_gid)
+      if (OwningThread(face_hash[f_gid]) == t) ++num_owned;
+
+    uint64_t capacity = 16;
+    while (capacity < 2*num_owned) capacity <<= 1;
+    const uint64_t mask = capacity - 1;
+    std::vector<uint64_t> table(capacity, EMPTY);
+
+    uint64_t c = 0;
+    for (uint64_t f_gid=0; f_gid<num_faces; ++f_gid)
     {
-      if (cur_cell_face.neighbor >= 0 ) continue;
+      while (face_offsets[c+1] <= f_gid) ++c;
 
-      std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                cur_cell_face.vertex_ids.end());
+      const uint64_t hash = face_hash[f_gid];
+      if (OwningThread(hash) != t) continue;
 
-      for (uint64_t adj_cell_id : cells_to_search)
-      {
-        auto adj_cell = umesh->raw_cells[adj_cell_id];
+      auto& face = raw_cells[c]->faces[f_gid - face_offsets[c]];
 
-        for (auto& adj_cell_face : adj_cell->faces)
+      uint64_t slot = hash & mask;
+      while (table[slot] != EMPTY)
+      {
+        const uint64_t adj_gid = table[slot];
+        if (face_hash[adj_gid] == hash)
         {
-          if (adj_cell_face.neighbor >= 0) continue;
-          std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                    adj_cell_face.vertex_ids.end());
+          uint64_t adj_c = CellOfFace(adj_gid);
+          auto& adj_face = raw_cells[adj_c]->faces[adj_gid-face_offsets[adj_c]];
 
-          if (cfvids == afvids)
+          if ((adj_face.neighbor < 0) and (adj_c != c) and
+              SameVertices(face.vertex_ids, adj_face.vertex_ids))
           {
-            cur_cell_face.neighbor = adj_cell_id;
-            adj_cell_face.neighbor = cur_cell_id;
-            goto face_neighbor_found;
+            face.neighbor     = static_cast<int>(adj_c);
+            adj_face.neighbor = static_cast<int>(c);
+            break;
           }
-        }//for adjacent cell face
+        }
+        slot = (slot + 1) & mask;
       }
-      face_neighbor_found:;
-    }//for face
 
-    ++cur_cell_id;
-  }//for cell
+      if (face.neighbor < 0)
+        table[slot] = f_gid;
+    }//for face
+  });
 
   chi_log.Log() << "Done establishing cell connectivity.";
 
   num_bndry_faces = 0;
-  for (auto cell : umesh->raw_cells)
+  for (auto cell : raw_cells)
     for (auto& face : cell->faces)
       if (face.neighbor < 0) ++num_bndry_faces;
 
   chi_log.Log(LOG_0VERBOSE_1) << chi_program_timer.GetTimeString()
                               << " Number of boundary faces "
                                  "after connectivity: " << num_bndry_faces;
-}
\ No newline at end of file
+}
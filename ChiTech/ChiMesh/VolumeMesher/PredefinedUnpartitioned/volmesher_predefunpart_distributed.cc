@@ -0,0 +1,534 @@
+#include "volmesher_predefunpart.h"
+
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+extern ChiLog& chi_log;
+extern ChiMPI& chi_mpi;
+
+#include "ChiTimer/chi_timer.h"
+extern ChiTimer chi_program_timer;
+
+#include "petsc.h"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <unordered_map>
+
+//###################################################################
+/**Sends send_data[loc] to each location loc and returns the data
+ * received from all locations, concatenated in the order of the
+ * sending locations.*/
+std::vector<uint64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  ExchangeSerialData(const std::vector<std::vector<uint64_t>>& send_data)
+{
+  const int num_locations = chi_mpi.process_count;
+
+  //============================================= Build send-counts and
+  //                                              send-displacements arrays,
+  //                                              and serialized vector
+  std::vector<int> send_counts(num_locations,0);
+  std::vector<int> send_displs(num_locations,0);
+  std::vector<uint64_t> send_buffer;
+
+  size_t total_send_size = 0;
+  for (const auto& data : send_data)
+    total_send_size += data.size();
+  send_buffer.reserve(total_send_size);
+
+  int displacement = 0;
+  for (int loc=0; loc<num_locations; ++loc)
+  {
+    send_counts[loc] = static_cast<int>(send_data[loc].size());
+    send_displs[loc] = displacement;
+    displacement += send_counts[loc];
+
+    send_buffer.insert(send_buffer.end(),
+                       send_data[loc].begin(),
+                       send_data[loc].end());
+  }
+
+  //============================================= Communicate counts
+  std::vector<int> recv_counts(num_locations,0);
+
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT,
+               recv_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  //============================================= Build receive displacements
+  std::vector<int> recv_displs(num_locations,0);
+  int total_receive_size = 0;
+  for (int loc=0; loc<num_locations; ++loc)
+  {
+    recv_displs[loc] = total_receive_size;
+    total_receive_size += recv_counts[loc];
+  }
+
+  //============================================= Receive serialized data
+  std::vector<uint64_t> recv_buffer(total_receive_size,0);
+  MPI_Alltoallv(send_buffer.data(),
+                send_counts.data(),
+                send_displs.data(),
+                MPI_UNSIGNED_LONG_LONG,
+                recv_buffer.data(),
+                recv_counts.data(),
+                recv_displs.data(),
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_COMM_WORLD);
+
+  return recv_buffer;
+}
+
+//###################################################################
+/**Establishes neighbor connectivity for a light-weight mesh of which
+ * every location only holds a block of the cells.
+ *
+ * Every face is sent, with its sorted vertex ids, to the location
+ * selected by the hash of the vertex ids. Both faces of a pair therefore
+ * arrive at the same location, which matches them with a flat
+ * open-addressing table (see BuildMeshConnectivity) and sends the
+ * neighbor's global id back to the locations holding the cells.*/
+void chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  BuildDistributedMeshConnectivity(chi_mesh::UnpartitionedMesh* umesh)
+{
+  auto& raw_cells = umesh->raw_cells;
+  const uint64_t cell_offset = umesh->GlobalCellOffset();
+  const int num_locations = chi_mpi.process_count;
+
+  auto CountBoundaryFaces = [&raw_cells]()
+  {
+    long long local_count = 0;
+    long long global_count = 0;
+    for (auto cell : raw_cells)
+      for (auto& face : cell->faces)
+        if (face.neighbor < 0) ++local_count;
+
+    MPI_Allreduce(&local_count,&global_count,1,
+                  MPI_LONG_LONG,MPI_SUM,MPI_COMM_WORLD);
+    return global_count;
+  };
+
+  long long num_bndry_faces = CountBoundaryFaces();
+  for (auto cell : raw_cells)
+    for (auto& face : cell->faces)
+      face.neighbor = -1;
+
+  chi_log.Log(LOG_0VERBOSE_1) << chi_program_timer.GetTimeString()
+                              << " Number of boundary faces "
+                                 "before connectivity: " << num_bndry_faces;
+
+  //======================================== Establish connectivity
+  chi_log.Log() << "Establishing distributed cell connectivity.";
+
+  //======================================== Send faces to hash owners
+  //Record: hash, cell global id, face index,
+  //        number of vertices, sorted vertex ids
+  //The high bits of the hash select the location,
+  //the low bits address the table.
+  std::vector<uint64_t> faces_recvd;
+  {
+    std::vector<std::vector<uint64_t>> face_data(num_locations);
+    std::vector<uint64_t> sorted_vids;
+    for (size_t c=0; c<raw_cells.size(); ++c)
+    {
+      uint64_t f=0;
+      for (const auto& face : raw_cells[c]->faces)
+      {
+        sorted_vids = face.vertex_ids;
+        std::sort(sorted_vids.begin(), sorted_vids.end());
+        const uint64_t hash = HashSortedVertexIds(sorted_vids);
+
+        auto& data = face_data[(hash >> 32) % num_locations];
+        data.push_back(hash);
+        data.push_back(cell_offset + c);
+        data.push_back(f++);
+        data.push_back(sorted_vids.size());
+        data.insert(data.end(), sorted_vids.begin(), sorted_vids.end());
+      }
+    }
+    faces_recvd = ExchangeSerialData(face_data);
+  }
+
+  //======================================== Index received faces
+  std::vector<size_t> face_starts;
+  for (size_t k=0; k<faces_recvd.size(); k += 4 + faces_recvd[k+3])
+    face_starts.push_back(k);
+  const uint64_t num_faces = face_starts.size();
+
+  //======================================== Match faces
+  std::vector<std::vector<uint64_t>> neighbor_data(num_locations);
+  {
+    const uint64_t EMPTY = ~uint64_t(0);
+    uint64_t capacity = 16;
+    while (capacity < 2*num_faces) capacity <<= 1;
+    const uint64_t mask = capacity - 1;
+    std::vector<uint64_t> table(capacity, EMPTY);
+    std::vector<bool> matched(num_faces, false);
+
+    auto SendNeighbor = [&](const uint64_t* face, const uint64_t* adj_face)
+    {
+      auto& data = neighbor_data[umesh->CellBlockOwner(face[1])];
+      data.push_back(face[1]);     //cell global id
+      data.push_back(face[2]);     //face index
+      data.push_back(adj_face[1]); //neighbor global id
+    };
+
+    for (uint64_t i=0; i<num_faces; ++i)
+    {
+      const uint64_t* face = &faces_recvd[face_starts[i]];
+      const uint64_t num_verts = face[3];
+
+      uint64_t slot = face[0] & mask;
+      while (table[slot] != EMPTY)
+      {
+        const uint64_t j = table[slot];
+        const uint64_t* adj_face = &faces_recvd[face_starts[j]];
+
+        if ((not matched[j]) and (adj_face[0] == face[0]) and
+            (adj_face[1] != face[1]) and (adj_face[3] == num_verts) and
+            std::equal(face+4, face+4+num_verts, adj_face+4))
+        {
+          matched[i] = true;
+          matched[j] = true;
+          SendNeighbor(face, adj_face);
+          SendNeighbor(adj_face, face);
+          break;
+        }
+        slot = (slot + 1) & mask;
+      }
+
+      if (not matched[i])
+        table[slot] = i;
+    }//for face
+  }
+  faces_recvd.clear();
+  faces_recvd.shrink_to_fit();
+
+  //======================================== Apply neighbors
+  auto neighbors_recvd = ExchangeSerialData(neighbor_data);
+  for (size_t k=0; k<neighbors_recvd.size(); k += 3)
+  {
+    auto cell = raw_cells[neighbors_recvd[k] - cell_offset];
+    cell->faces[neighbors_recvd[k+1]].neighbor =
+      static_cast<int>(neighbors_recvd[k+2]);
+  }
+
+  chi_log.Log() << "Done establishing distributed cell connectivity.";
+
+  num_bndry_faces = CountBoundaryFaces();
+
+  chi_log.Log(LOG_0VERBOSE_1) << chi_program_timer.GetTimeString()
+                              << " Number of boundary faces "
+                                 "after connectivity: " << num_bndry_faces;
+}
+
+//###################################################################
+/**Partitions a light-weight mesh of which every location holds a block
+ * of the cells by handing the distributed adjacency graph to ParMETIS.
+ * Returns the partition id of each local raw cell.*/
+std::vector<int> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  DistributedPARMETIS(chi_mesh::UnpartitionedMesh* umesh)
+{
+  const auto& raw_cells = umesh->raw_cells;
+  const size_t num_local_cells = raw_cells.size();
+  const uint64_t num_global_cells = umesh->cell_block_starts.back();
+
+  //======================================== Build indices
+  std::vector<int> i_indices(num_local_cells+1,0);
+  std::vector<int> j_indices;
+  int icount = 0;
+  for (size_t c=0; c<num_local_cells; ++c)
+  {
+    i_indices[c] = icount;
+
+    for (auto& face : raw_cells[c]->faces)
+      if (face.neighbor >= 0)
+      {
+        j_indices.push_back(face.neighbor);
+        ++icount;
+      }
+  }
+  i_indices[num_local_cells] = icount;
+
+  //======================================== Copy to raw arrays
+  int* i_indices_raw;
+  int* j_indices_raw;
+  PetscMalloc(i_indices.size()*sizeof(int),&i_indices_raw);
+  PetscMalloc(j_indices.size()*sizeof(int),&j_indices_raw);
+
+  std::copy(i_indices.begin(), i_indices.end(), i_indices_raw);
+  std::copy(j_indices.begin(), j_indices.end(), j_indices_raw);
+
+  chi_log.Log(LOG_0VERBOSE_1) << "Done building distributed indices.";
+
+  //========================================= Create adjacency matrix
+  Mat Adj; //Adjacency matrix
+  MatCreateMPIAdj(PETSC_COMM_WORLD,
+                  (int)num_local_cells,
+                  (int)num_global_cells,
+                  i_indices_raw,j_indices_raw,NULL,&Adj);
+
+  //========================================= Create partitioning
+  MatPartitioning part;
+  IS is;
+  MatPartitioningCreate(PETSC_COMM_WORLD,&part);
+  MatPartitioningSetAdjacency(part,Adj);
+  MatPartitioningSetType(part,"parmetis");
+  MatPartitioningSetNParts(part,chi_mpi.process_count);
+  MatPartitioningApply(part,&is);
+  MatPartitioningDestroy(&part);
+  MatDestroy(&Adj);
+
+  //========================================= Get cell partition ids
+  std::vector<int> cell_pids(num_local_cells,0);
+  const int* cell_pids_raw;
+  ISGetIndices(is,&cell_pids_raw);
+  std::copy(cell_pids_raw, cell_pids_raw + num_local_cells, cell_pids.begin());
+  ISRestoreIndices(is,&cell_pids_raw);
+  ISDestroy(&is);
+
+  return cell_pids;
+}
+
+//###################################################################
+/**Partitions a light-weight mesh of which every location only holds a
+ * block of the cells, migrates the cells to their owning locations and
+ * loads the local cells and their ghosts into the grid. No location
+ * ever holds more raw cells than its block, its own cells and their
+ * ghosts. The vertices are not distributed, every location copies all
+ * of them since the grid indexes vertices by global id.*/
+void chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  DistributedPartition(chi_mesh::UnpartitionedMesh* umesh,
+                       chi_mesh::MeshContinuumPtr grid)
+{
+  chi_log.Log(LOG_0) << "Partitioning distributed mesh.";
+
+  const auto& raw_cells = umesh->raw_cells;
+  const uint64_t cell_offset = umesh->GlobalCellOffset();
+  const int num_locations = chi_mpi.process_count;
+  const int location_id = chi_mpi.location_id;
+
+  //======================================== Partition ids of local cells
+  std::vector<int> cell_pids;
+  if (options.partition_type == PartitionType::KBA_STYLE_XY or
+      options.partition_type == PartitionType::KBA_STYLE_XYZ)
+  {
+    cell_pids.reserve(raw_cells.size());
+    for (auto raw_cell : raw_cells)
+      cell_pids.push_back(GetPartitionIDFromCentroid(raw_cell->centroid));
+  }
+  else
+    cell_pids = DistributedPARMETIS(umesh);
+
+  chi_log.Log(LOG_0) << "Done partitioning mesh.";
+
+  //======================================== Partition ids of neighbors
+  //                                         held by other locations
+  //Request: requesting location, cell global id
+  //Reply  : cell global id, partition id
+  std::unordered_map<uint64_t,int> foreign_pids;
+  {
+    std::vector<std::set<uint64_t>> requested_ids(num_locations);
+    for (auto raw_cell : raw_cells)
+      for (auto& face : raw_cell->faces)
+      {
+        if (face.neighbor < 0) continue;
+        int loc = umesh->CellBlockOwner(face.neighbor);
+        if (loc != location_id)
+          requested_ids[loc].insert(face.neighbor);
+      }
+
+    std::vector<std::vector<uint64_t>> request_data(num_locations);
+    for (int loc=0; loc<num_locations; ++loc)
+      for (uint64_t global_id : requested_ids[loc])
+      {
+        request_data[loc].push_back(location_id);
+        request_data[loc].push_back(global_id);
+      }
+
+    auto requests_recvd = ExchangeSerialData(request_data);
+
+    std::vector<std::vector<uint64_t>> reply_data(num_locations);
+    for (size_t k=0; k<requests_recvd.size(); k += 2)
+    {
+      auto& data = reply_data[requests_recvd[k]];
+      data.push_back(requests_recvd[k+1]);
+      data.push_back(cell_pids[requests_recvd[k+1] - cell_offset]);
+    }
+
+    auto replies_recvd = ExchangeSerialData(reply_data);
+    foreign_pids.reserve(replies_recvd.size()/2);
+    for (size_t k=0; k<replies_recvd.size(); k += 2)
+      foreign_pids[replies_recvd[k]] = static_cast<int>(replies_recvd[k+1]);
+  }
+
+  auto NeighborPID = [&](uint64_t global_id)
+  {
+    if (umesh->CellBlockOwner(global_id) == location_id)
+      return cell_pids[global_id - cell_offset];
+    return foreign_pids.at(global_id);
+  };
+
+  //======================================== Serialize cells and ghosts
+  //Header: is_ghost, global id, partition id, material id,
+  //        cell type, centroid x, y, z
+  //Cell  : num vertices, vertex ids, num faces,
+  //        per face: neighbor, boundary id, num vertices, vertex ids
+  auto PushDouble = [](std::vector<uint64_t>& data, double value)
+  {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    data.push_back(bits);
+  };
+  auto PushInt = [](std::vector<uint64_t>& data, int value)
+  {
+    data.push_back(static_cast<uint64_t>(static_cast<int64_t>(value)));
+  };
+
+  std::vector<std::vector<uint64_t>> cell_data(num_locations);
+  for (size_t c=0; c<raw_cells.size(); ++c)
+  {
+    const auto& raw_cell = *raw_cells[c];
+    const int pid = cell_pids[c];
+
+    auto PushHeader = [&](std::vector<uint64_t>& data, bool is_ghost)
+    {
+      data.push_back(is_ghost? 1 : 0);
+      data.push_back(cell_offset + c);
+      PushInt(data, pid);
+      PushInt(data, raw_cell.material_id);
+      data.push_back(static_cast<uint64_t>(raw_cell.type));
+      PushDouble(data, raw_cell.centroid.x);
+      PushDouble(data, raw_cell.centroid.y);
+      PushDouble(data, raw_cell.centroid.z);
+    };
+
+    //=================================== Owner
+    auto& data = cell_data[pid];
+    PushHeader(data, false);
+    data.push_back(raw_cell.vertex_ids.size());
+    data.insert(data.end(), raw_cell.vertex_ids.begin(),
+                            raw_cell.vertex_ids.end());
+    data.push_back(raw_cell.faces.size());
+    for (const auto& face : raw_cell.faces)
+    {
+      PushInt(data, face.neighbor);
+      data.push_back(face.bndry_id);
+      data.push_back(face.vertex_ids.size());
+      data.insert(data.end(), face.vertex_ids.begin(),
+                              face.vertex_ids.end());
+    }
+
+    //=================================== Ghost for neighbor partitions
+    std::set<int> ghost_pids;
+    for (const auto& face : raw_cell.faces)
+    {
+      if (face.neighbor < 0) continue;
+      int adj_pid = NeighborPID(face.neighbor);
+      if (adj_pid != pid) ghost_pids.insert(adj_pid);
+    }
+    for (int adj_pid : ghost_pids)
+      PushHeader(cell_data[adj_pid], true);
+  }//for c
+
+  auto cells_recvd = ExchangeSerialData(cell_data);
+  cell_data.clear();
+  cell_data.shrink_to_fit();
+
+  chi_log.Log(LOG_0) << "Done migrating cells.";
+
+  //======================================== Index received cells
+  //Cells are loaded in global id order, the
+  //same order as the non-distributed partitioners.
+  const size_t HEADER_SIZE = 8;
+  std::vector<std::pair<uint64_t,size_t>> cell_starts;
+  for (size_t k=0; k<cells_recvd.size(); )
+  {
+    cell_starts.emplace_back(cells_recvd[k+1], k);
+    const bool is_ghost = (cells_recvd[k] == 1);
+    k += HEADER_SIZE;
+    if (is_ghost) continue;
+
+    k += 1 + cells_recvd[k];
+    const uint64_t num_faces = cells_recvd[k++];
+    for (uint64_t f=0; f<num_faces; ++f)
+      k += 3 + cells_recvd[k+2];
+  }
+  std::sort(cell_starts.begin(), cell_starts.end());
+
+  //======================================== Load up the vertices
+  for (auto vert : umesh->vertices)
+    grid->vertices.push_back(new chi_mesh::Vertex(*vert));
+
+  //======================================== Load up the cells
+  auto ReadInt = [](uint64_t value)
+  {
+    return static_cast<int>(static_cast<int64_t>(value));
+  };
+  auto ReadDouble = [](uint64_t bits)
+  {
+    double value;
+    std::memcpy(&value, &bits, sizeof(double));
+    return value;
+  };
+
+  for (const auto& cell_start : cell_starts)
+  {
+    size_t k = cell_start.second;
+    const bool is_ghost = (cells_recvd[k] == 1);
+
+    auto temp_cell = new chi_mesh::Cell(chi_mesh::CellType::GHOST);
+    temp_cell->global_id    = cells_recvd[k+1];
+    temp_cell->partition_id = ReadInt(cells_recvd[k+2]);
+    temp_cell->material_id  = ReadInt(cells_recvd[k+3]);
+    auto cell_type = static_cast<chi_mesh::CellType>(cells_recvd[k+4]);
+    temp_cell->centroid = chi_mesh::Vertex(ReadDouble(cells_recvd[k+5]),
+                                           ReadDouble(cells_recvd[k+6]),
+                                           ReadDouble(cells_recvd[k+7]));
+    k += HEADER_SIZE;
+
+    if (is_ghost)
+    {
+      grid->cells.push_back(temp_cell);
+      continue;
+    }
+
+    chi_mesh::UnpartitionedMesh::LightWeightCell raw_cell(cell_type);
+    raw_cell.centroid = temp_cell->centroid;
+    raw_cell.material_id = temp_cell->material_id;
+
+    const uint64_t num_verts = cells_recvd[k++];
+    raw_cell.vertex_ids.assign(cells_recvd.begin() + k,
+                               cells_recvd.begin() + k + num_verts);
+    k += num_verts;
+
+    const uint64_t num_faces = cells_recvd[k++];
+    raw_cell.faces.resize(num_faces);
+    for (auto& face : raw_cell.faces)
+    {
+      face.neighbor = ReadInt(cells_recvd[k++]);
+      face.bndry_id = cells_recvd[k++];
+      const uint64_t num_face_verts = cells_recvd[k++];
+      face.vertex_ids.assign(cells_recvd.begin() + k,
+                             cells_recvd.begin() + k + num_face_verts);
+      k += num_face_verts;
+    }
+
+    if (cell_type == chi_mesh::CellType::SLAB)
+      AddSlabToGrid(raw_cell,*temp_cell,*grid);
+    else if (cell_type == chi_mesh::CellType::POLYGON)
+      AddPolygonToGrid(raw_cell,*temp_cell,*grid);
+    else if (cell_type == chi_mesh::CellType::POLYHEDRON)
+      AddPolyhedronToGrid(raw_cell,*temp_cell,*grid);
+    else
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Unsupported cell encountered in "
+           "chi_mesh::VolumeMesherPredefinedUnpartitioned";
+      exit(EXIT_FAILURE);
+    }
+    delete temp_cell;
+  }//for cell
+}
@@ -75,7 +75,10 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
 
   //======================================== Build mesh connectivity
   auto umesh = mesh_handler->unpartitionedmesh_stack.back();
-  BuildMeshConnectivity(umesh);
+  if (umesh->IsDivided())
+    BuildDistributedMeshConnectivity(umesh);
+  else
+    BuildMeshConnectivity(umesh);
 
   //======================================== Compute centroids
   for (auto cell : umesh->raw_cells)
@@ -94,8 +97,10 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
   //======================================== Apply partitioning scheme
   auto grid = chi_mesh::MeshContinuum::New();
 
-  if (options.partition_type == PartitionType::KBA_STYLE_XY or
-      options.partition_type == PartitionType::KBA_STYLE_XYZ)
+  if (umesh->IsDivided())
+    DistributedPartition(umesh, grid);
+  else if (options.partition_type == PartitionType::KBA_STYLE_XY or
+           options.partition_type == PartitionType::KBA_STYLE_XYZ)
     KBA(umesh, grid);
   else
     PARMETIS(umesh,grid);
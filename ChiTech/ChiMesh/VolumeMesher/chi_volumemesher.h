@@ -15,7 +15,8 @@ namespace chi_mesh
     LINEMESH1D   = 1,
     PREDEFINED2D = 3,
     EXTRUDER     = 4,
-    PREDEFINED3D = 5
+    PREDEFINED3D = 5,
+    UNPARTITIONED = 6
   };
   enum VolumeMesherProperty
   {
@@ -30,7 +31,8 @@ namespace chi_mesh
     PARTITION_TYPE      = 9,
     EXTRUSION_LAYER     = 10,
     MATID_FROMLOGICAL   = 11,
-    BNDRYID_FROMLOGICAL = 12
+    BNDRYID_FROMLOGICAL = 12,
+    CONNECTIVITY_THREADS = 13
   };
 };
 
@@ -74,6 +76,7 @@ public:
     bool         mesh_global    = false;
     int          partition_z    = 1;
     PartitionType partition_type = PARMETIS;
+    int          connectivity_num_threads = 1;
   };
   VOLUME_MESHER_OPTIONS options;
 public:
@@ -740,6 +740,7 @@ void chi_mesh::VolumeMesher::
       ++num_cells_modified;
     }
   }
+  vol_cont->InvalidatePackedView();
   MPI_Barrier(MPI_COMM_WORLD);
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
@@ -774,6 +775,7 @@ void chi_mesh::VolumeMesher::
       }
     }
   }
+  vol_cont->InvalidatePackedView();
 
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
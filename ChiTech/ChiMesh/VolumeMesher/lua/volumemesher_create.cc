@@ -4,6 +4,7 @@
 #include "../Predefined2D/volmesher_predefined2d.h"
 #include "../Extruder/volmesher_extruder.h"
 #include "../Predefined3D/volmesher_predefined3d.h"
+#include "../PredefinedUnpartitioned/volmesher_predefunpart.h"
 
 #include "../../MeshHandler/chi_meshhandler.h"
 
@@ -56,6 +57,9 @@ Remesher types:\n
  VOLUMEMESHER_PREDEFINED2D = No remeshing is performed.\n
  VOLUMEMESHER_EXTRUDER = Extruder the first surface mesh found.\n
  VOLUMEMESHER_PREDEFINED3D = Create the mesh from the latest UnpartitionedMesh.\n
+ VOLUMEMESHER_UNPARTITIONED = Partition the latest UnpartitionedMesh. Required
+                              for meshes read with the DIVIDE_WORK parallel
+                              method.\n
 
 \ingroup LuaVolumeMesher
 \author Jan*/
@@ -82,14 +86,19 @@ int chiVolumeMesherCreate(lua_State *L)
   {
     new_mesher = new chi_mesh::VolumeMesherPredefined3D;
   }
+  else if (type==chi_mesh::VolumeMesherType::UNPARTITIONED)  //VOLUMEMESHER_UNPARTITIONED
+  {
+    new_mesher = new chi_mesh::VolumeMesherPredefinedUnpartitioned;
+  }
   else
   {
     chi_log.Log(LOG_0ERROR) << "Invalid Volume mesher type in function "
                                "chiVolumeMesherCreate. Allowed options are"
                                "VOLUMEMESHER_LINEMESH1D, "
                                "VOLUMEMESHER_PREDEFINED2D, "
-                               "VOLUMEMESHER_EXTRUDER or "
-                               "VOLUMEMESHER_PREDEFINED3D";
+                               "VOLUMEMESHER_EXTRUDER, "
+                               "VOLUMEMESHER_PREDEFINED3D or "
+                               "VOLUMEMESHER_UNPARTITIONED";
     exit(EXIT_FAILURE);
   }
 
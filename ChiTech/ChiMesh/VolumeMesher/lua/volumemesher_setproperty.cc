@@ -54,6 +54,9 @@ extern ChiLog& chi_log;
                      boundary id to the specified value for cells
                      that meet the sense requirement for the given
                      logical volume.\n
+ CONNECTIVITY_THREADS = <B>PropertyValue:[int]</B> Number of threads used
+                        to establish the cell connectivity of unpartitioned
+                        meshes [Default=1].\n
 
 ## _
 
@@ -219,6 +222,19 @@ int chiVolumeMesherSetProperty(lua_State *L)
       cur_hndlr->logicvolume_stack[volume_hndl];
     cur_hndlr->volume_mesher->SetBndryIDFromLogical(volume_ptr,sense,bndry_id);
   }
+
+  else if (property_index == VMP::CONNECTIVITY_THREADS)
+  {
+    int num_threads = lua_tonumber(L,2);
+    if (num_threads < 1)
+    {
+      chi_log.Log(LOG_ALLERROR) << "Invalid number of threads used in "
+                                 "chiVolumeMesherSetProperty("
+                                 "CONNECTIVITY_THREADS...";
+      exit(EXIT_FAILURE);
+    }
+    cur_hndlr->volume_mesher->options.connectivity_num_threads = num_threads;
+  }
   else
   {
     chi_log.Log(LOG_ALLERROR) << "Invalid property specified in call to "
@@ -103,6 +103,9 @@ chiLBSGroupsetSetAngleAggregationType(phys,gs,LBSGroupset.ANGLE_AGG_SINGLE)
 chiLBSSetMaxKIterations(phys,max_k_iters)
 chiLBSSetKTolerance(phys,k_tol)
 chiLBSSetUsePrecursors(phys,use_precursors)
+if (k_method ~= nil) then
+    chiLBSSetKEigenMethod(phys,k_method)
+end
 
 -- ############################## Run the problem
 chiKEigenvalueLBSInitialize(phys)
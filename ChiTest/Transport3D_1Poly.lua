@@ -112,6 +112,15 @@ if (master_export == nil) then
 end
 chiLBSGroupsetSetMaxIterations(phys1,cur_gs,300)
 chiLBSGroupsetSetGMRESRestartIntvl(phys1,cur_gs,100)
+if (sweep_num_threads ~= nil) then
+    chiLBSGroupsetSetSweepNumThreads(phys1,cur_gs,sweep_num_threads)
+end
+if (sweep_scheduler ~= nil) then
+    chiLBSGroupsetSetSweepScheduler(phys1,cur_gs,sweep_scheduler)
+end
+if (fluds_reorder_ties ~= nil) then
+    chiLBSGroupsetSetFLUDSReorderTies(phys1,cur_gs,fluds_reorder_ties)
+end
 
 --========== Boundary conditions
 bsrc={}
@@ -123,6 +132,9 @@ chiLBSSetProperty(phys1,BOUNDARY_CONDITION,ZMIN,LBSBoundaryTypes.INCIDENT_ISOTRO
 
 --========== Solvers
 chiLBSSetProperty(phys1,DISCRETIZATION_METHOD,PWLD3D)
+if (sweep_aggregation ~= nil) then
+    chiLBSSetProperty(phys1,SWEEP_MESSAGE_AGGREGATION,sweep_aggregation)
+end
 
 chiLBSInitialize(phys1)
 chiLBSExecute(phys1)
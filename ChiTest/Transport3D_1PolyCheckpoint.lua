@@ -0,0 +1,209 @@
+-- Mesh checkpoint regression. Run in three stages:
+--   checkpoint_stage=0 : Build an orthogonal mesh and export it to VTU
+--                        (1 process).
+--   checkpoint_stage=1 : Read the VTU, solve and write a mesh checkpoint.
+--   checkpoint_stage=2 : Read the checkpoint, with the same or a different
+--                        process count, and solve.
+-- Stages 1 and 2 print the number of cells and the same maxima so that
+-- the checkpoint runs can be compared against the VTU run. Stage 1 moves
+-- the zmin faces to boundary 1, which is reflecting in a diffusion solve
+-- while boundary 0 is Dirichlet, so Max-value3 also checks that boundary
+-- ids survive the checkpoint. The diffusion solve comes first since the
+-- transport solver reassigns boundary ids from the face normals.
+-- With divide_work=true stage 1 reads the VTU with DIVIDE_WORK, and with
+-- connectivity_threads=n it establishes the connectivity with n threads.
+-- Neither writes the checkpoint. Stage 1 prints the number of boundary
+-- faces after connectivity.
+if (checkpoint_stage == nil) then checkpoint_stage = 1 end
+if (divide_work == nil) then divide_work = false end
+write_checkpoint = ((not divide_work) and (connectivity_threads == nil))
+
+vtu_base        = "ChiTest/Transport3D_1PolyCheckpoint_Mesh"
+checkpoint_dir  = "ChiTest/Transport3D_1PolyCheckpoint"
+checkpoint_base = "mesh"
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+if (checkpoint_stage == 0) then
+    mesh={}
+    N=10
+    L=2.0
+    xmin = -1.0
+    dx = L/N
+    for i=1,(N+1) do
+        k=i-1
+        mesh[i] = xmin + k*dx
+    end
+    umesh,region1 = chiMeshCreateUnpartitioned3DOrthoMesh(mesh,mesh,mesh)
+    chiVolumeMesherExecute();
+
+    chiRegionExportMeshToVTK(region1,vtu_base)
+    return
+elseif (checkpoint_stage == 1) then
+    if (divide_work) then
+        chiUnpartitionedMeshFromVTU(vtu_base.."_0.vtu",DIVIDE_WORK)
+    else
+        chiUnpartitionedMeshFromVTU(vtu_base.."_0.vtu")
+    end
+
+    region1 = chiRegionCreate()
+    chiRegionAddEmptyBoundary(region1)
+    chiRegionAddEmptyBoundary(region1)
+    chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED)
+    chiVolumeMesherSetProperty(PARTITION_TYPE,PARMETIS)
+    if (connectivity_threads ~= nil) then
+        chiVolumeMesherSetProperty(CONNECTIVITY_THREADS,connectivity_threads)
+    end
+    chiLogSetVerbosity(1)
+    chiVolumeMesherExecute();
+    chiLogSetVerbosity(0)
+
+    --========== Material IDs are not read from the VTU
+    vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+    chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+    vol1 = chiLogicalVolumeCreate(RPP,-0.5,0.5,-0.5,0.5,-1000,1000)
+    chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+    --========== Boundary IDs, zmin faces to boundary 1
+    zmin_vol = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,-0.99999)
+    chiVolumeMesherSetProperty(BNDRYID_FROMLOGICAL,zmin_vol,1)
+else
+    --========== Material and boundary IDs come from the checkpoint
+    region1 = chiRegionCreate()
+    chiRegionAddEmptyBoundary(region1)
+    chiRegionAddEmptyBoundary(region1)
+    chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED)
+    chiVolumeMesherSetProperty(PARTITION_TYPE,PARMETIS)
+    chiMeshReadCheckpoint(checkpoint_dir,checkpoint_base)
+
+    vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+end
+
+if ((checkpoint_stage == 1) and write_checkpoint) then
+    chiRegionExportMeshToCheckpoint(region1,checkpoint_dir,checkpoint_base)
+end
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+--========== Diffusion coefficient and source
+for m=1,2 do
+    chiPhysicsMaterialAddProperty(materials[m],SCALAR_VALUE)
+    chiPhysicsMaterialSetProperty(materials[m],SCALAR_VALUE,SINGLE_VALUE,1.0)
+    chiPhysicsMaterialAddProperty(materials[m],SCALAR_VALUE)
+    chiPhysicsMaterialSetProperty(materials[m],SCALAR_VALUE,SINGLE_VALUE,1.0)
+end
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+
+num_groups = 21
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+        PDT_XSFILE,"ChiTest/xs_graphite_pure.data")
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+        PDT_XSFILE,"ChiTest/xs_graphite_pure.data")
+
+src={}
+for g=1,num_groups do
+    src[g] = 0.0
+end
+
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+src[1]=1.0
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+
+
+--############################################### Diffusion
+phys0 = chiDiffusionCreateSolver();
+chiSolverAddRegion(phys0,region1)
+chiDiffusionSetProperty(phys0,DISCRETIZATION_METHOD,PWLC);
+chiDiffusionSetProperty(phys0,RESIDUAL_TOL,1.0e-8)
+chiDiffusionSetProperty(phys0,PROPERTY_SIGMAA_MAP,-1)
+
+chiDiffusionSetProperty(phys0,BOUNDARY_TYPE,0,DIFFUSION_DIRICHLET,0.0)
+chiDiffusionSetProperty(phys0,BOUNDARY_TYPE,1,DIFFUSION_REFLECTING)
+
+chiDiffusionInitialize(phys0)
+chiDiffusionExecute(phys0)
+fftemp,count = chiGetFieldFunctionList(phys0)
+
+ffi0 = chiFFInterpolationCreate(VOLUME)
+chiFFInterpolationSetProperty(ffi0,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(ffi0,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(ffi0,ADD_FIELDFUNCTION,fftemp[1])
+
+chiFFInterpolationInitialize(ffi0)
+chiFFInterpolationExecute(ffi0)
+maxval = chiFFInterpolationGetValue(ffi0)
+
+chiLog(LOG_0,string.format("Max-value3=%.5e", maxval))
+
+--############################################### Setup Physics
+
+phys1 = chiLBSCreateSolver()
+chiSolverAddRegion(phys1,region1)
+
+--========== Groups
+grp = {}
+for g=1,num_groups do
+    grp[g] = chiLBSCreateGroup(phys1)
+end
+
+--========== ProdQuad
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+--========== Groupset def
+gs0 = chiLBSCreateGroupset(phys1)
+cur_gs = gs0
+chiLBSGroupsetAddGroups(phys1,cur_gs,0,20)
+chiLBSGroupsetSetQuadrature(phys1,cur_gs,pquad)
+chiLBSGroupsetSetAngleAggregationType(phys1,cur_gs,LBSGroupset.ANGLE_AGG_SINGLE)
+chiLBSGroupsetSetAngleAggDiv(phys1,cur_gs,1)
+chiLBSGroupsetSetGroupSubsets(phys1,cur_gs,1)
+chiLBSGroupsetSetIterativeMethod(phys1,cur_gs,NPT_GMRES)
+chiLBSGroupsetSetResidualTolerance(phys1,cur_gs,1.0e-6)
+chiLBSGroupsetSetMaxIterations(phys1,cur_gs,300)
+chiLBSGroupsetSetGMRESRestartIntvl(phys1,cur_gs,100)
+
+--========== Solvers
+chiLBSSetProperty(phys1,DISCRETIZATION_METHOD,PWLD3D)
+
+chiLBSInitialize(phys1)
+chiLBSExecute(phys1)
+
+
+
+fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+
+ffi1 = chiFFInterpolationCreate(VOLUME)
+curffi = ffi1
+chiFFInterpolationSetProperty(curffi,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(curffi,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(curffi,ADD_FIELDFUNCTION,fflist[1])
+
+chiFFInterpolationInitialize(curffi)
+chiFFInterpolationExecute(curffi)
+maxval = chiFFInterpolationGetValue(curffi)
+
+chiLog(LOG_0,string.format("Max-value1=%.5e", maxval))
+
+ffi1 = chiFFInterpolationCreate(VOLUME)
+curffi = ffi1
+chiFFInterpolationSetProperty(curffi,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(curffi,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(curffi,ADD_FIELDFUNCTION,fflist[20])
+
+chiFFInterpolationInitialize(curffi)
+chiFFInterpolationExecute(curffi)
+maxval = chiFFInterpolationGetValue(curffi)
+
+chiLog(LOG_0,string.format("Max-value2=%.5e", maxval))
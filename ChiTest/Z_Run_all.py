@@ -27,6 +27,15 @@ def format3(number):
 def FormatFileName(filename):
   return "{:35s}".format(filename)
 
+def FindValue(out,find_str):
+  #Returns the number following find_str in out, or None if not found
+  test_str_start    = out.find(find_str)
+  if (test_str_start < 0):
+    return None
+  test_str_end      = test_str_start + len(find_str)
+  test_str_line_end = out.find("\n",test_str_start)
+  return float(out[test_str_end:test_str_line_end])
+
 #=========================================== Test
 test_number += 1
 test_name = FormatFileName("Diffusion1D") + " 1D Diffusion Test - CFEM 1 MPI Process"
@@ -624,6 +633,282 @@ test_str_end      = test_str_start + len(find_str)
 #end of the line at which string was found
 test_str_line_end = out.find("\n",test_str_start)
 
+# test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-3.76339e-04) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1Poly") + " 3D LinearBSolver Test - PWLD 4 MPI Processes 2 Threads"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","4",kpath_to_exe,
+                            "ChiTest/Transport3D_1Poly.lua", "master_export=false",
+                            "sweep_num_threads=2"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]  Max-value1="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-5.27450e-01) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+#string to find in output
+find_str          = "[0]  Max-value2="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+# test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-3.76339e-04) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1Poly") + " 3D LinearBSolver Test - PWLD 4 MPI Processes Message Aggregation"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","4",kpath_to_exe,
+                            "ChiTest/Transport3D_1Poly.lua", "master_export=false",
+                            "sweep_aggregation=64000"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]  Max-value1="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-5.27450e-01) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+#string to find in output
+find_str          = "[0]  Max-value2="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+# test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-3.76339e-04) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1Poly") + " 3D LinearBSolver Test - PWLD 4 MPI Processes Critical-Path Scheduler"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","4",kpath_to_exe,
+                            "ChiTest/Transport3D_1Poly.lua", "master_export=false",
+                            "sweep_scheduler=3"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]  Max-value1="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-5.27450e-01) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+#string to find in output
+find_str          = "[0]  Max-value2="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+# test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-3.76339e-04) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1Poly") + " 3D LinearBSolver Test - PWLD 4 MPI Processes FLUDS Tie Reordering"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","4",kpath_to_exe,
+                            "ChiTest/Transport3D_1Poly.lua", "master_export=false",
+                            "fluds_reorder_ties=true"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]  Max-value1="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-5.27450e-01) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+#string to find in output
+find_str          = "[0]  Max-value2="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+# test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-3.76339e-04) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+# On a single process the outer side faces are boundary faces and precede
+# the local top face of a cell, which checks the FLUDS outgoing slot indices.
+test_number += 1
+test_name = FormatFileName("Transport3D_1Poly") + " 3D LinearBSolver Test - PWLD 1 MPI Process Boundary Face Slots"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","1",kpath_to_exe,
+                            "ChiTest/Transport3D_1Poly.lua", "master_export=false"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]  Max-value1="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-5.27450e-01) < 1.0e-4):
+        test_passed = False
+else:
+    test_passed = False
+
+#string to find in output
+find_str          = "[0]  Max-value2="
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
 # test_passed = True
 if (test_str_start >= 0):
     #convert value to number
@@ -873,6 +1158,305 @@ else:
     print(" - FAILED!")
     num_failed += 1
 
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("KEigenvalueTransport1D_1G") + " 1D KSolver Wielandt Test - PWLD 4 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","4",kpath_to_exe,
+                            "ChiTest/KEigenvalueTransport1D_1G.lua", "master_export=false",
+                            "k_method=2"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]          Final k-eigenvalue    :"
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-0.997501) < 1.0e-5):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("KEigenvalueTransport1D_1G") + " 1D KSolver JFNK Test - PWLD 4 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","4",kpath_to_exe,
+                            "ChiTest/KEigenvalueTransport1D_1G.lua", "master_export=false",
+                            "k_method=3"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#string to find in output
+find_str          = "[0]          Final k-eigenvalue    :"
+#start of the string (<0 if not found)
+test_str_start    = out.find(find_str)
+#end of the string to find
+test_str_end      = test_str_start + len(find_str)
+#end of the line at which string was found
+test_str_line_end = out.find("\n",test_str_start)
+
+test_passed = True
+if (test_str_start >= 0):
+    #convert value to number
+    test_val = float(out[test_str_end:test_str_line_end])
+    if (not abs(test_val-0.997501) < 1.0e-5):
+        test_passed = False
+else:
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1PolyCheckpoint") + " 3D Mesh Checkpoint Test - VTU Export 1 MPI Process"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","1",kpath_to_exe,
+                            "ChiTest/Transport3D_1PolyCheckpoint.lua", "master_export=false",
+                            "checkpoint_stage=0"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+test_passed = os.path.isfile(kchi_src_pth +
+                             "ChiTest/Transport3D_1PolyCheckpoint_Mesh_0.vtu")
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1PolyCheckpoint") + " 3D Mesh Checkpoint Test - VTU Write 2 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","2",kpath_to_exe,
+                            "ChiTest/Transport3D_1PolyCheckpoint.lua", "master_export=false",
+                            "checkpoint_stage=1"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+#Reference values for the checkpoint runs
+vtu_num_cells  = FindValue(out,"VolumeMesherPredefinedUnpartitioned: Cells created = ")
+vtu_num_bndry_faces = FindValue(out,"Number of boundary faces after connectivity: ")
+vtu_max_value1 = FindValue(out,"[0]  Max-value1=")
+vtu_max_value2 = FindValue(out,"[0]  Max-value2=")
+vtu_max_value3 = FindValue(out,"[0]  Max-value3=")
+
+test_passed = True
+if ((vtu_num_cells == None) or (vtu_max_value1 == None) or
+    (vtu_max_value2 == None) or (vtu_max_value3 == None)):
+    test_passed = False
+elif (vtu_num_cells != 1000.0):
+    test_passed = False
+elif (vtu_num_bndry_faces != 600.0):
+    test_passed = False
+if (out.find("Mesh checkpoint written to") < 0):
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1PolyCheckpoint") + " 3D Mesh Checkpoint Test - VTU 4 Connectivity Threads 2 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","2",kpath_to_exe,
+                            "ChiTest/Transport3D_1PolyCheckpoint.lua", "master_export=false",
+                            "checkpoint_stage=1", "connectivity_threads=4"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+num_cells  = FindValue(out,"VolumeMesherPredefinedUnpartitioned: Cells created = ")
+num_bndry_faces = FindValue(out,"Number of boundary faces after connectivity: ")
+max_value1 = FindValue(out,"[0]  Max-value1=")
+max_value2 = FindValue(out,"[0]  Max-value2=")
+max_value3 = FindValue(out,"[0]  Max-value3=")
+
+test_passed = True
+if ((vtu_num_cells == None) or (vtu_num_bndry_faces == None) or
+    (vtu_max_value1 == None) or (vtu_max_value2 == None) or
+    (vtu_max_value3 == None)):
+    test_passed = False
+elif ((num_cells == None) or (num_bndry_faces == None) or
+      (max_value1 == None) or (max_value2 == None) or (max_value3 == None)):
+    test_passed = False
+elif (num_cells != vtu_num_cells):
+    test_passed = False
+elif (num_bndry_faces != vtu_num_bndry_faces):
+    test_passed = False
+elif (not abs(max_value1-vtu_max_value1) < 1.0e-4*abs(vtu_max_value1)):
+    test_passed = False
+elif (not abs(max_value2-vtu_max_value2) < 1.0e-4*abs(vtu_max_value2)):
+    test_passed = False
+elif (not abs(max_value3-vtu_max_value3) < 1.0e-4*abs(vtu_max_value3)):
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1PolyCheckpoint") + " 3D Mesh Checkpoint Test - VTU DIVIDE_WORK 3 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","3",kpath_to_exe,
+                            "ChiTest/Transport3D_1PolyCheckpoint.lua", "master_export=false",
+                            "checkpoint_stage=1", "divide_work=true"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+num_cells  = FindValue(out,"VolumeMesherPredefinedUnpartitioned: Cells created = ")
+max_value1 = FindValue(out,"[0]  Max-value1=")
+max_value2 = FindValue(out,"[0]  Max-value2=")
+max_value3 = FindValue(out,"[0]  Max-value3=")
+
+test_passed = True
+if ((vtu_num_cells == None) or (vtu_max_value1 == None) or
+    (vtu_max_value2 == None) or (vtu_max_value3 == None)):
+    test_passed = False
+elif ((num_cells == None) or (max_value1 == None) or (max_value2 == None) or
+      (max_value3 == None)):
+    test_passed = False
+elif (out.find("Cells divided amongst 3 locations.") < 0):
+    test_passed = False
+elif (num_cells != vtu_num_cells):
+    test_passed = False
+elif (not abs(max_value1-vtu_max_value1) < 1.0e-4*abs(vtu_max_value1)):
+    test_passed = False
+elif (not abs(max_value2-vtu_max_value2) < 1.0e-4*abs(vtu_max_value2)):
+    test_passed = False
+elif (not abs(max_value3-vtu_max_value3) < 1.0e-4*abs(vtu_max_value3)):
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1PolyCheckpoint") + " 3D Mesh Checkpoint Test - Read 2 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","2",kpath_to_exe,
+                            "ChiTest/Transport3D_1PolyCheckpoint.lua", "master_export=false",
+                            "checkpoint_stage=2"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+num_cells  = FindValue(out,"Cells read = ")
+max_value1 = FindValue(out,"[0]  Max-value1=")
+max_value2 = FindValue(out,"[0]  Max-value2=")
+max_value3 = FindValue(out,"[0]  Max-value3=")
+
+test_passed = True
+if ((vtu_num_cells == None) or (vtu_max_value1 == None) or
+    (vtu_max_value2 == None) or (vtu_max_value3 == None)):
+    test_passed = False
+elif ((num_cells == None) or (max_value1 == None) or (max_value2 == None) or
+      (max_value3 == None)):
+    test_passed = False
+elif (num_cells != vtu_num_cells):
+    test_passed = False
+elif (not abs(max_value1-vtu_max_value1) < 1.0e-4*abs(vtu_max_value1)):
+    test_passed = False
+elif (not abs(max_value2-vtu_max_value2) < 1.0e-4*abs(vtu_max_value2)):
+    test_passed = False
+elif (not abs(max_value3-vtu_max_value3) < 1.0e-4*abs(vtu_max_value3)):
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
+#=========================================== Test
+test_number += 1
+test_name = FormatFileName("Transport3D_1PolyCheckpoint") + " 3D Mesh Checkpoint Test - Repartition 3 MPI Processes"
+print("Running Test " + format3(test_number) + " " + test_name,end='',flush=True)
+process = subprocess.Popen(["mpiexec","-np","3",kpath_to_exe,
+                            "ChiTest/Transport3D_1PolyCheckpoint.lua", "master_export=false",
+                            "checkpoint_stage=2"],
+                           cwd=kchi_src_pth,
+                           stdout=subprocess.PIPE,
+                           universal_newlines=True)
+process.wait()
+out,err = process.communicate()
+
+num_cells  = FindValue(out,"VolumeMesherPredefinedUnpartitioned: Cells created = ")
+max_value1 = FindValue(out,"[0]  Max-value1=")
+max_value2 = FindValue(out,"[0]  Max-value2=")
+max_value3 = FindValue(out,"[0]  Max-value3=")
+
+test_passed = True
+if ((vtu_num_cells == None) or (vtu_max_value1 == None) or
+    (vtu_max_value2 == None) or (vtu_max_value3 == None)):
+    test_passed = False
+elif ((num_cells == None) or (max_value1 == None) or (max_value2 == None) or
+      (max_value3 == None)):
+    test_passed = False
+elif (num_cells != vtu_num_cells):
+    test_passed = False
+elif (not abs(max_value1-vtu_max_value1) < 1.0e-4*abs(vtu_max_value1)):
+    test_passed = False
+elif (not abs(max_value2-vtu_max_value2) < 1.0e-4*abs(vtu_max_value2)):
+    test_passed = False
+elif (not abs(max_value3-vtu_max_value3) < 1.0e-4*abs(vtu_max_value3)):
+    test_passed = False
+
+if (test_passed):
+    print(" - Passed")
+else:
+    print(" - FAILED!")
+    num_failed += 1
+
 #$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ END OF TESTS
 print("")
 if (num_failed == 0):